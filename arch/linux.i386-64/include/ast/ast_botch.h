@@ -0,0 +1,5 @@
+/* : : generated from /root/repo/src/lib/libast/features/botch.c by iffe version 2024-03-20 : : */
+#ifndef _def_botch_ast
+#define _def_botch_ast	1
+#define _sys_types	1	/* #include <sys/types.h> ok */
+#endif
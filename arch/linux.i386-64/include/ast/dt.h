@@ -0,0 +1,31 @@
+/***********************************************************************
+*                                                                      *
+*               This software is part of the ast package               *
+*          Copyright (c) 1985-2011 AT&T Intellectual Property          *
+*          Copyright (c) 2020-2022 Contributors to ksh 93u+m           *
+*                      and is licensed under the                       *
+*                 Eclipse Public License, Version 2.0                  *
+*                                                                      *
+*                A copy of the License is available at                 *
+*      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      *
+*         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         *
+*                                                                      *
+*                 Glenn Fowler <gsf@research.att.com>                  *
+*                  David Korn <dgk@research.att.com>                   *
+*                   Phong Vo <kpv@research.att.com>                    *
+*                  Martijn Dekker <martijn@inlv.org>                   *
+*                                                                      *
+***********************************************************************/
+
+#ifndef _DT_H
+#define _DT_H		1
+
+#include <cdt.h>
+#include <vmalloc.h>
+
+extern Dt_t*		dtnew(Vmalloc_t*, Dtdisc_t*, Dtmethod_t*);
+extern Dt_t*		_dtnew(Vmalloc_t*, Dtdisc_t*, Dtmethod_t*, unsigned long);
+
+#define dtnew(v,d,m)	_dtnew(v,d,m,CDT_VERSION)
+
+#endif
@@ -0,0 +1,41 @@
+/***********************************************************************
+*                                                                      *
+*               This software is part of the ast package               *
+*          Copyright (c) 1985-2011 AT&T Intellectual Property          *
+*          Copyright (c) 2020-2022 Contributors to ksh 93u+m           *
+*                      and is licensed under the                       *
+*                 Eclipse Public License, Version 2.0                  *
+*                                                                      *
+*                A copy of the License is available at                 *
+*      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      *
+*         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         *
+*                                                                      *
+*                 Glenn Fowler <gsf@research.att.com>                  *
+*                  David Korn <dgk@research.att.com>                   *
+*                   Phong Vo <kpv@research.att.com>                    *
+*                  Martijn Dekker <martijn@inlv.org>                   *
+*                                                                      *
+***********************************************************************/
+/*
+ * AT&T Research
+ *
+ * external mode_t representation support
+ */
+
+#ifndef _MODEX_H
+#define _MODEX_H
+
+#include <ast_fs.h>
+#include <modecanon.h>
+
+extern int		modei(int);
+extern int		modex(int);
+
+#if _S_IDPERM
+#define modei(m)	((m)&X_IPERM)
+#if _S_IDTYPE
+#define modex(m)	(m)
+#endif
+#endif
+
+#endif
@@ -0,0 +1,200 @@
+/* : : generated from /root/repo/src/lib/libast/features/limits.c by iffe version 2024-03-20 : : */
+#ifndef _def_limits_ast
+#define _def_limits_ast	1
+#define _sys_types	1	/* #include <sys/types.h> ok */
+
+
+#ifndef AIO_MAX
+#define AIO_MAX 1
+#endif
+#ifndef AIO_PRIO_DELTA_MAX
+#define AIO_PRIO_DELTA_MAX 20
+#endif
+#ifndef ARG_MAX
+#define ARG_MAX 2097152
+#endif
+#ifndef ATEXIT_MAX
+#define ATEXIT_MAX 2147483647
+#endif
+#ifndef CHARCLASS_NAME_MAX
+#define CHARCLASS_NAME_MAX 2048
+#endif
+#ifndef CHAR_BIT
+#define CHAR_BIT 8
+#endif
+#ifndef CHAR_MAX
+#define CHAR_MAX 127
+#endif
+#ifndef CHAR_MIN
+#define CHAR_MIN -128
+#endif
+#ifndef CHILD_MAX
+#define CHILD_MAX 24002
+#endif
+#ifndef CLK_TCK
+#define CLK_TCK 100
+#endif
+#ifndef FCHR_MAX
+#define FCHR_MAX 2147483647
+#endif
+#ifndef FILESIZEBITS
+#define FILESIZEBITS 32
+#endif
+#ifndef INT_MAX
+#define INT_MAX 2147483647
+#endif
+#ifndef INT_MIN
+#define INT_MIN -2147483648
+#endif
+#ifndef LLONG_MAX
+#define LLONG_MAX 9223372036854775807
+#endif
+#ifndef LLONG_MIN
+#define LLONG_MIN -9223372036854775808
+#endif
+#ifndef LOGIN_NAME_MAX
+#define LOGIN_NAME_MAX 256
+#endif
+#ifndef LONG_BIT
+#define LONG_BIT 64
+#endif
+#ifndef LONG_MAX
+#define LONG_MAX 9223372036854775807
+#endif
+#ifndef LONG_MIN
+#define LONG_MIN -9223372036854775808
+#endif
+#ifndef MB_LEN_MAX
+#define MB_LEN_MAX 16
+#endif
+#ifndef NL_ARGMAX
+#define NL_ARGMAX 4096
+#endif
+#ifndef NL_LANGMAX
+#define NL_LANGMAX 2048
+#endif
+#ifndef NL_MSGMAX
+#define NL_MSGMAX 2147483647
+#endif
+#ifndef NL_NMAX
+#define NL_NMAX 2147483647
+#endif
+#ifndef NL_SETMAX
+#define NL_SETMAX 2147483647
+#endif
+#ifndef NL_TEXTMAX
+#define NL_TEXTMAX 2147483647
+#endif
+#ifndef NSS_BUFLEN_GROUP
+#define NSS_BUFLEN_GROUP 1024
+#endif
+#ifndef NSS_BUFLEN_PASSWD
+#define NSS_BUFLEN_PASSWD 1024
+#endif
+#ifndef NZERO
+#define NZERO 20
+#endif
+#ifndef OPEN_MAX
+#define OPEN_MAX 20000
+#endif
+#ifndef PASS_MAX
+#define PASS_MAX 8192
+#endif
+#ifndef PATH_MAX
+#define PATH_MAX 4096
+#endif
+#ifndef PID_MAX
+#define PID_MAX 32768
+#endif
+#ifndef PTHREAD_DESTRUCTOR_ITERATIONS
+#define PTHREAD_DESTRUCTOR_ITERATIONS 4
+#endif
+#ifndef PTHREAD_KEYS_MAX
+#define PTHREAD_KEYS_MAX 1024
+#endif
+#ifndef PTRDIFF_MAX
+#define PTRDIFF_MAX 9223372036854775807
+#endif
+#ifndef PTRDIFF_MIN
+#define PTRDIFF_MIN -9223372036854775808
+#endif
+#ifndef RE_DUP_MAX
+#define RE_DUP_MAX 32767
+#endif
+#ifndef SCHAR_MAX
+#define SCHAR_MAX 127
+#endif
+#ifndef SCHAR_MIN
+#define SCHAR_MIN -128
+#endif
+#ifndef SHRT_MAX
+#define SHRT_MAX 32767
+#endif
+#ifndef SHRT_MIN
+#define SHRT_MIN -32768
+#endif
+#ifndef SIG_ATOMIC_MAX
+#define SIG_ATOMIC_MAX 2147483647
+#endif
+#ifndef SIG_ATOMIC_MIN
+#define SIG_ATOMIC_MIN -2147483648
+#endif
+#ifndef SIZE_MAX
+#define SIZE_MAX 18446744073709551615
+#endif
+#ifndef SSIZE_MAX
+#define SSIZE_MAX 32767
+#endif
+#ifndef STD_BLK
+#define STD_BLK 1024
+#endif
+#ifndef SYSPID_MAX
+#define SYSPID_MAX 2
+#endif
+#ifndef THREAD_DESTRUCTOR_ITERATIONS
+#define THREAD_DESTRUCTOR_ITERATIONS 4
+#endif
+#ifndef THREAD_KEYS_MAX
+#define THREAD_KEYS_MAX 128
+#endif
+#ifndef THREAD_THREADS_MAX
+#define THREAD_THREADS_MAX 64
+#endif
+#ifndef TMP_MAX
+#define TMP_MAX 238328
+#endif
+#ifndef UCHAR_MAX
+#define UCHAR_MAX 255
+#endif
+#ifndef UID_MAX
+#define UID_MAX 60002
+#endif
+#ifndef UINT_MAX
+#define UINT_MAX 4294967295
+#endif
+#ifndef ULLONG_MAX
+#define ULLONG_MAX 18446744073709551615
+#endif
+#ifndef ULONG_MAX
+#define ULONG_MAX 18446744073709551615
+#endif
+#ifndef USHRT_MAX
+#define USHRT_MAX 65535
+#endif
+#ifndef WCHAR_MAX
+#define WCHAR_MAX 2147483647
+#endif
+#ifndef WCHAR_MIN
+#define WCHAR_MIN -2147483648
+#endif
+#ifndef WINT_MAX
+#define WINT_MAX 4294967295
+#endif
+#ifndef WINT_MIN
+#define WINT_MIN 0
+#endif
+#ifndef WORD_BIT
+#define WORD_BIT 32
+#endif
+
+#endif
@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1982-2012 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2024 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -105,9 +105,39 @@ struct Enum
 	Namfun_t	hdr;
 	short		nelem;
 	short		iflag;
+	unsigned short	hmask;		/* size of hash table - 1 */
+	unsigned short	*hash;		/* value index + 1 per slot, 0 if empty */
 	const char	*values[1];
 };
 
+/*
+ * hash of an enum value, case-insensitive if <iflag> is set
+ */
+static unsigned int enum_hash(const char *s, int iflag)
+{
+	unsigned int	h = 2166136261U;
+	int		c;
+	while(c = *(unsigned char*)s++)
+		h = (h ^ (iflag ? tolower(c) : c)) * 16777619U;
+	return h ^ (h >> 15);
+}
+
+/*
+ * return the index of value <val> in <ep>, or -1 if none
+ */
+static int enum_find(struct Enum *ep, const char *val)
+{
+	unsigned int	h = enum_hash(val,ep->iflag);
+	int		i;
+	while(i = ep->hash[h &= ep->hmask])
+	{
+		if((ep->iflag ? strcasecmp(ep->values[i-1],val) : strcmp(ep->values[i-1],val))==0)
+			return i-1;
+		h++;
+	}
+	return -1;
+}
+
 /*
  * For range checking in arith.c
  */
@@ -159,8 +189,7 @@ static Namfun_t *clone_enum(Namval_t* np, Namval_t *mp, int flags, Namfun_t *fp)
 static void put_enum(Namval_t* np,const char *val,int flags,Namfun_t *fp)
 {
 	struct Enum 		*ep = (struct Enum*)fp;
-	const char		*v;
-	unsigned short		i=0;
+	unsigned short		i;
 	int			n;
 	if(!val)
 	{
@@ -175,18 +204,11 @@ static void put_enum(Namval_t* np,const char *val,int flags,Namfun_t *fp)
 		nv_putv(np,val,flags,fp);
 		return;
 	}
-	while(v=ep->values[i])
+	if((n = enum_find(ep,val)) >= 0)
 	{
-		if(ep->iflag)
-			n = strcasecmp(v,val);
-		else
-			n = strcmp(v,val);
-		if(n==0)
-		{
-			nv_putv(np, (char*)&i, NV_UINT16, fp);
-			return;
-		}
-		i++;
+		i = n;
+		nv_putv(np, (char*)&i, NV_UINT16, fp);
+		return;
 	}
 	error(ERROR_exit(1), "%s: invalid value %s",nv_name(np),val);
 	UNREACHABLE();
@@ -207,7 +229,8 @@ const Namdisc_t ENUM_disc = { 0, put_enum, get_enum, nv_getn, 0, 0, clone_enum }
 
 int b_enum(int argc, char** argv, Shbltin_t *context)
 {
-	int			sz,i,n,iflag = 0;
+	int			sz,i,n,hsize,iflag = 0;
+	unsigned int		h;
 	Namval_t		*np, *tp;
 	Namarr_t		*ap;
 	char			*cp,*sp;
@@ -256,6 +279,11 @@ int b_enum(int argc, char** argv, Shbltin_t *context)
 			error(ERROR_exit(1), "%s must name an array containing at least two elements",cp);
 			UNREACHABLE();
 		}
+		if(sz > SHRT_MAX)
+		{
+			error(ERROR_exit(1), "%s: more than %d enumeration values",cp,SHRT_MAX);
+			UNREACHABLE();
+		}
 		sfprintf(sh.strbuf,"%s.%s",NV_CLASS,np->nvname);
 		tp = nv_open(sfstruse(sh.strbuf), sh.var_tree, NV_VARNAME);
 		n = sz;
@@ -269,10 +297,15 @@ int b_enum(int argc, char** argv, Shbltin_t *context)
 		}
 		while(nv_nextsub(np));
 		sz += n*sizeof(char*);
+		/* open addressing hash table of the values, at most half full */
+		for(hsize = 4; hsize < 2*n; hsize <<= 1);
+		sz += hsize*sizeof(unsigned short);
 		ep = sh_newof(0,struct Enum,1,sz);
 		ep->iflag = iflag;
 		ep->nelem = n;
-		cp = (char*)&ep->values[n+1];
+		ep->hmask = hsize-1;
+		ep->hash = (unsigned short*)&ep->values[n+1];
+		cp = (char*)&ep->hash[hsize];
 		nv_putsub(np, NULL, ARRAY_SCAN);
 		ep->values[n] = 0;
 		i = 0;
@@ -283,6 +316,12 @@ int b_enum(int argc, char** argv, Shbltin_t *context)
 			n = strlen(sp);
 			memcpy(cp,sp,n+1);
 			cp += n+1;
+			/* keep the first of duplicate values, as a linear search would */
+			if(enum_find(ep,ep->values[i-1]) < 0)
+			{
+				for(h = enum_hash(ep->values[i-1],iflag); ep->hash[h &= ep->hmask]; h++);
+				ep->hash[h] = i;
+			}
 		}
 		while(nv_nextsub(np));
 		ep->hdr.dsize = sizeof(struct Enum)+sz;
@@ -0,0 +1,201 @@
+/***********************************************************************
+*                                                                      *
+*               This software is part of the ast package               *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
+*                      and is licensed under the                       *
+*                 Eclipse Public License, Version 2.0                  *
+*                                                                      *
+*                A copy of the License is available at                 *
+*      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      *
+*         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         *
+*                                                                      *
+*                  Martijn Dekker <martijn@inlv.org>                   *
+*                                                                      *
+***********************************************************************/
+/*
+ * filestat [-AP] varname file...
+ *
+ * Sets <varname> to an array with a compound variable of attributes for
+ * each file, so that the metadata of many files can be examined without
+ * running ls(1) or stat(1) in a command substitution for each of them.
+ * The members are assigned directly, relative to the dictionary in which
+ * <varname> was found, so that a nameref resolves to its target's scope.
+ */
+
+#include	"shopt.h"
+#include	"defs.h"
+#include	<error.h>
+#include	<ls.h>
+#include	<tmx.h>
+#include	"name.h"
+#include	"io.h"
+#include	"test.h"
+#include	"builtins.h"
+
+struct filestat
+{
+	Sfio_t	*out;		/* buffer for member names */
+	Dt_t	*root;		/* dictionary holding the array */
+	int	len;		/* length of the element name in out */
+};
+
+static const char *filetype(mode_t mode)
+{
+	if(S_ISREG(mode))
+		return "regular";
+	if(S_ISDIR(mode))
+		return "directory";
+	if(S_ISLNK(mode))
+		return "symlink";
+	if(S_ISFIFO(mode))
+		return "fifo";
+	if(S_ISSOCK(mode))
+		return "socket";
+	if(S_ISCHR(mode))
+		return "character";
+	if(S_ISBLK(mode))
+		return "block";
+	return "unknown";
+}
+
+/*
+ * assign <value> to member <name> of the current element
+ */
+static void putmember(struct filestat *fp, const char *name, const char *value)
+{
+	Namval_t	*mp;
+	sfseek(fp->out,(Sfoff_t)fp->len,SEEK_SET);
+	sfprintf(fp->out,".%s",name);
+	mp = nv_open(sfstruse(fp->out),fp->root,NV_VARNAME|NV_NOSCOPE);
+	nv_putval(mp,value,0);
+	nv_close(mp);
+}
+
+static void putnum(struct filestat *fp, const char *name, Sfulong_t n)
+{
+	char	buf[32];
+	sfsprintf(buf,sizeof(buf),"%llu",n);
+	putmember(fp,name,buf);
+}
+
+static void puttime(struct filestat *fp, const char *name, Time_t t)
+{
+	char	buf[48];
+	sfsprintf(buf,sizeof(buf),"%llu.%09lu",(Sfulong_t)tmxsec(t),(unsigned long)tmxnsec(t));
+	putmember(fp,name,buf);
+}
+
+/*
+ * assign the members for the attributes in <st> of <file>
+ */
+static void putattr(struct filestat *fp, const char *file, struct stat *st, int physical)
+{
+	char	buf[PATH_MAX+1];
+	ssize_t	n;
+	putmember(fp,"type",filetype(st->st_mode));
+	sfsprintf(buf,sizeof(buf),"%o",(int)(st->st_mode&07777));
+	putmember(fp,"mode",buf);
+	putmember(fp,"perms",fmtmode(st->st_mode,1));
+	putnum(fp,"nlink",(Sfulong_t)st->st_nlink);
+	putnum(fp,"uid",(Sfulong_t)st->st_uid);
+	putnum(fp,"gid",(Sfulong_t)st->st_gid);
+	putmember(fp,"user",fmtuid(st->st_uid));
+	putmember(fp,"group",fmtgid(st->st_gid));
+	sfsprintf(buf,sizeof(buf),"%lld",(Sflong_t)st->st_size);
+	putmember(fp,"size",buf);
+	sfsprintf(buf,sizeof(buf),"%lld",(Sflong_t)st->st_blocks);
+	putmember(fp,"blocks",buf);
+	putnum(fp,"dev",(Sfulong_t)st->st_dev);
+	putnum(fp,"ino",(Sfulong_t)st->st_ino);
+	puttime(fp,"atime",tmxgetatime(st));
+	puttime(fp,"mtime",tmxgetmtime(st));
+	puttime(fp,"ctime",tmxgetctime(st));
+	if(physical && S_ISLNK(st->st_mode) && (n = readlink(file,buf,PATH_MAX)) >= 0)
+	{
+		buf[n] = 0;
+		putmember(fp,"target",buf);
+	}
+}
+
+int	b_filestat(int argc,char *argv[],Shbltin_t *context)
+{
+	struct stat	statb;
+	struct filestat	fs;
+	Namval_t	*np;
+	const char	*cp;
+	char		*name, *file;
+	int		n, r, err, assoc=0, physical=0, status=0;
+	NOT_USED(argc);
+	NOT_USED(context);
+	while((n = optget(argv,sh_optfilestat))) switch(n)
+	{
+	    case 'A':
+		assoc = 1;
+		break;
+	    case 'P':
+		physical = 1;
+		break;
+	    case ':':
+		errormsg(SH_DICT,2, "%s", opt_info.arg);
+		break;
+	    case '?':
+		errormsg(SH_DICT,ERROR_usage(2), "%s", opt_info.arg);
+		UNREACHABLE();
+	}
+	argv += opt_info.index;
+	if(error_info.errors || !argv[0] || !argv[1])
+	{
+		errormsg(SH_DICT,ERROR_usage(2),"%s",optusage(NULL));
+		UNREACHABLE();
+	}
+	/* namerefs are followed here; sh.last_root is the scope of the target */
+	np = nv_open(*argv++,sh.var_tree,NV_VARNAME|NV_NOARRAY);
+	fs.root = sh.last_root;
+	if(nv_isattr(np,NV_RDONLY))
+	{
+		errormsg(SH_DICT,ERROR_exit(1),e_readonly,nv_name(np));
+		UNREACHABLE();
+	}
+	nv_unset(np);
+	if(assoc)
+		nv_setarray(np,nv_associative);
+	name = stkcopy(sh.stk,nv_name(np));
+	nv_close(np);
+	fs.out = sfstropen();
+	for(n=0; file = argv[n]; n++)
+	{
+		if(physical && !sh_isdevfd(file))
+			r = lstat(file,&statb);
+		else
+			r = test_stat(file,&statb);
+		err = errno;
+		sfputr(fs.out,name,'[');
+		if(assoc)
+		{
+			/* the subscript is taken literally once backslashes are removed */
+			for(cp=file; *cp; cp++)
+			{
+				if(*cp=='\\' || *cp=='[' || *cp==']')
+					sfputc(fs.out,'\\');
+				sfputc(fs.out,*cp);
+			}
+		}
+		else
+			sfprintf(fs.out,"%d",n);
+		sfputc(fs.out,']');
+		fs.len = (int)sftell(fs.out);
+		putmember(&fs,"name",file);
+		if(r < 0)
+		{
+			putmember(&fs,"error",fmterror(err));
+			errno = err;
+			errormsg(SH_DICT,ERROR_system(0),"%s: cannot get file status",file);
+			status = 1;
+		}
+		else
+			putattr(&fs,file,&statb,physical);
+		sfseek(fs.out,(Sfoff_t)0,SEEK_SET);
+	}
+	sfclose(fs.out);
+	return status;
+}
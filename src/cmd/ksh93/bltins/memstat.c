@@ -0,0 +1,178 @@
+/***********************************************************************
+*                                                                      *
+*               This software is part of the ast package               *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
+*                      and is licensed under the                       *
+*                 Eclipse Public License, Version 2.0                  *
+*                                                                      *
+*                A copy of the License is available at                 *
+*      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      *
+*         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         *
+*                                                                      *
+*                  Martijn Dekker <martijn@inlv.org>                   *
+*                                                                      *
+***********************************************************************/
+/*
+ * memstat [category...]
+ *
+ * Reports the number of objects and the bytes of memory held by each kind
+ * of shell data structure, found by walking the structures themselves, so
+ * that it works with any malloc(3). Sizes are those requested from the
+ * allocator; its own overhead is not known and not counted.
+ */
+
+#include	"shopt.h"
+#include	"defs.h"
+#include	<regex.h>
+#include	"name.h"
+#include	"history.h"
+#include	"builtins.h"
+
+typedef struct Memstat_s
+{
+	const char	*name;
+	size_t		count;
+	size_t		bytes;
+} Memstat_t;
+
+enum
+{
+	MEM_VARIABLES,
+	MEM_LOCALS,
+	MEM_ARRAYS,
+	MEM_FUNCTIONS,
+	MEM_ALIASES,
+	MEM_TRACKED,
+	MEM_STACK,
+	MEM_SFIO,
+	MEM_REGEX,
+	MEM_HISTORY,
+	MEM_TOTAL,
+	MEM_N
+};
+
+static const char *memnames[MEM_N] =
+{
+	"variables", "locals", "arrays", "functions", "aliases", "tracked",
+	"stack", "sfio", "regex", "history", "total"
+};
+
+/*
+ * add the nodes of dictionary <root> without the dictionaries it views to
+ * <mp>, and their array elements to the arrays entry <ap> if not NULL
+ */
+static void memtree(Dt_t *root, Memstat_t *mp, Memstat_t *ap)
+{
+	Namval_t	*np;
+	Dt_t		*view = dtview(root,NULL);
+	size_t		n;
+	for(np=(Namval_t*)dtfirst(root); np; np=(Namval_t*)dtnext(root,np))
+	{
+		mp->count++;
+		mp->bytes += nv_nodesize(np);
+		if(ap && nv_isarray(np))
+			ap->bytes += nv_memsize(np,&ap->count);
+		else
+		{
+			n = 0;
+			mp->bytes += nv_memsize(np,&n);
+		}
+	}
+	if(view)
+		dtview(root,view);
+}
+
+/*
+ * add the function nodes of <root> and their parse trees to <mp>
+ */
+static void memfuns(Dt_t *root, Memstat_t *mp)
+{
+	Namval_t	*np;
+	Dt_t		*view = dtview(root,NULL);
+	for(np=(Namval_t*)dtfirst(root); np; np=(Namval_t*)dtnext(root,np))
+	{
+		if(!is_afunction(np) || !np->nvalue.rp)
+			continue;
+		mp->count++;
+		mp->bytes += nv_nodesize(np) + sizeof(struct Ufunction) + np->nvalue.rp->treesize;
+	}
+	if(view)
+		dtview(root,view);
+}
+
+int	b_memstat(int argc,char *argv[],Shbltin_t *context)
+{
+	Memstat_t	mem[MEM_N];
+	Dt_t		*dp;
+	Sfio_t		*f;
+	Stkstat_t	st;
+	char		**av;
+	int		i;
+	NOT_USED(argc);
+	NOT_USED(context);
+	while((i = optget(argv,sh_optmemstat))) switch(i)
+	{
+	    case ':':
+		errormsg(SH_DICT,2, "%s", opt_info.arg);
+		break;
+	    case '?':
+		errormsg(SH_DICT,ERROR_usage(2), "%s", opt_info.arg);
+		UNREACHABLE();
+	}
+	argv += opt_info.index;
+	for(av=argv; *av; av++)
+	{
+		for(i=0; i < MEM_N && strcmp(*av,memnames[i]); i++);
+		if(i==MEM_N)
+			errormsg(SH_DICT,2,"%s: unknown category",*av);
+	}
+	if(error_info.errors)
+	{
+		errormsg(SH_DICT,ERROR_usage(2),"%s",optusage(NULL));
+		UNREACHABLE();
+	}
+	memset(mem,0,sizeof(mem));
+	for(i=0; i < MEM_N; i++)
+		mem[i].name = memnames[i];
+	/* the global scope and the scopes of the running functions */
+	for(dp=sh.var_tree; dp; dp=dtvnext(dp))
+		memtree(dp,&mem[dp==sh.var_base?MEM_VARIABLES:MEM_LOCALS],&mem[MEM_ARRAYS]);
+	memfuns(sh.fun_tree,&mem[MEM_FUNCTIONS]);
+	memtree(sh.alias_tree,&mem[MEM_ALIASES],NULL);
+	memtree(sh.track_tree,&mem[MEM_TRACKED],NULL);
+	stkstat(sh.stk,&st,0);
+	mem[MEM_STACK].count = st.frames;
+	mem[MEM_STACK].bytes = st.size + st.spare;
+	mem[MEM_SFIO].bytes = sh.lim.open_max*(sizeof(int*)+sizeof(Sfio_t*)+1);
+	for(i=0; i < sh.lim.open_max; i++)
+	{
+		if(!(f = sh.sftable[i]))
+			continue;
+		sfsetbuf(f,(void*)f,0);
+		mem[MEM_SFIO].count++;
+		mem[MEM_SFIO].bytes += sizeof(Sfio_t) + sfvalue(f);
+	}
+	mem[MEM_REGEX].count = regcachesize(&mem[MEM_REGEX].bytes);
+	if(sh.hist_ptr)
+	{
+		i = hist_min(sh.hist_ptr);
+		mem[MEM_HISTORY].count = hist_max(sh.hist_ptr) - (i ? i : 1);
+		mem[MEM_HISTORY].bytes = hist_memsize(sh.hist_ptr);
+	}
+	for(i=0; i < MEM_TOTAL; i++)
+	{
+		mem[MEM_TOTAL].count += mem[i].count;
+		mem[MEM_TOTAL].bytes += mem[i].bytes;
+	}
+	for(i=0; i < MEM_N; i++)
+	{
+		if(*argv)
+		{
+			for(av=argv; *av && strcmp(*av,mem[i].name); av++);
+			if(!*av)
+				continue;
+		}
+		sfprintf(sfstdout,"%-10s %10llu %12llu\n",mem[i].name,(Sfulong_t)mem[i].count,(Sfulong_t)mem[i].bytes);
+	}
+	return 0;
+}
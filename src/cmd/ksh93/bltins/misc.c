@@ -313,6 +313,7 @@ int    b_dot_cmd(int n,char *argv[],Shbltin_t *context)
 	jmpval = sigsetjmp(buff.buff,0);
 	if(jmpval == 0)
 	{
+		sh_profcall(np ? nv_name(np) : script,sh.st.filename,np && np->nvalue.rp ? np->nvalue.rp->lineno : 1);
 		sh.dot_depth++;
 		update_sh_level();
 		if(np)
@@ -326,6 +327,7 @@ int    b_dot_cmd(int n,char *argv[],Shbltin_t *context)
 		}
 	}
 	sh_popcontext(&buff);
+	sh_profreturn();
 	if(buffer)
 		free(buffer);
 	if(!np)
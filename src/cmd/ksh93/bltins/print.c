@@ -175,6 +175,9 @@ int    b_print(int argc, char *argv[], Shbltin_t *context)
 	int nflag=0, rflag=0, vflag=0;
 	Namval_t *vname=0;
 	Optdisc_t disc;
+#if SHOPT_STATS
+	Sfoff_t start = 0;
+#endif /* SHOPT_STATS */
 	exitval = 0;
 	memset(&disc, 0, sizeof(disc));
 	disc.version = OPT_VERSION;
@@ -363,6 +366,9 @@ skip2:
 	}
 	/* turn off share to guarantee atomic writes for printf */
 	n = sfset(outfile,SFIO_SHARE|SFIO_PUBLIC,0);
+#if SHOPT_STATS
+	start = sftell(outfile);
+#endif /* SHOPT_STATS */
 printf_v:
 	if(format)
 	{
@@ -425,6 +431,9 @@ printf_v:
 #endif /* !SHOPT_SCRIPTONLY */
 	else
 	{
+#if SHOPT_STATS
+		sh_statsadd(wbytes,sftell(outfile)-start);
+#endif /* SHOPT_STATS */
 		if(n&SFIO_SHARE)
 			sfset(outfile,SFIO_SHARE|SFIO_PUBLIC,1);
 		if (sfsync(outfile) < 0)
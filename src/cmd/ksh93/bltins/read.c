@@ -451,6 +451,7 @@ int sh_readline(char **names, volatile int fd, int flags, ssize_t size, Sflong_t
 					if(f)
 						sfread(iop,cp,c);
 					cur += c;
+					sh_statsadd(rbytes,c);
 					if(mbwide() && !binary)
 					{
 						int	x;
@@ -512,10 +513,14 @@ int sh_readline(char **names, volatile int fd, int flags, ssize_t size, Sflong_t
 		goto done;
 	}
 	else if(cp = (unsigned char*)sfgetr(iop,delim,0))
+	{
 		c = sfvalue(iop);
+		sh_statsadd(rbytes,c);
+	}
 	else if(cp = (unsigned char*)sfgetr(iop,delim,-1))
 	{
 		c = sfvalue(iop)+1;
+		sh_statsadd(rbytes,c-1);
 		if(!sferror(iop) && sfgetc(iop) >=0)
 		{
 			errormsg(SH_DICT,ERROR_exit(1),e_overlimit,"line length");
@@ -659,6 +664,7 @@ int sh_readline(char **names, volatile int fd, int flags, ssize_t size, Sflong_t
 					c = sfvalue(iop)+1;
 				if(cp)
 				{
+					sh_statsadd(rbytes,sfvalue(iop));
 #if !SHOPT_SCRIPTONLY
 					if(flags&S_FLAG)
 						sfwrite(sh.hist_ptr->histfp,(char*)cp,c);
@@ -756,6 +762,8 @@ int sh_readline(char **names, volatile int fd, int flags, ssize_t size, Sflong_t
 								c = sfvalue(iop);
 							else if(cp = (unsigned char*)sfgetr(iop,delim,-1))
 								c = sfvalue(iop)+1;
+							if(cp)
+								sh_statsadd(rbytes,sfvalue(iop));
 							val = (char*)cp;
 						}
 						continue;
@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1982-2012 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2024 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -59,7 +59,7 @@
 
 #define	permission(a,f)		(sh_access(a,f)==0)
 static int	test_time(const char*, const char*);
-static int	test_stat(const char*, struct stat*);
+static int	statcached(const char*, struct stat*, int);
 static int	test_mode(const char*);
 
 /* single char string compare */
@@ -74,6 +74,24 @@ struct test
         char    **av;
 };
 
+/*
+ * While sh.statcache is set, test_stat() keeps the results of stat(2)
+ * for the last few file names, so that the operators of one test
+ * expression such as [[ -f $f && -r $f && $f -nt $ref ]] stat $f once.
+ * sh_exec() clears the cache before it runs anything that is not part
+ * of a [[ ... ]] expression, as that could change the file system.
+ */
+#define STATCACHE	4
+
+static struct Statcache
+{
+	char		*name;
+	size_t		size;		/* allocated size of name */
+	int		err;		/* errno if stat(2) failed, else 0 */
+	struct stat	statb;
+} statcache[STATCACHE];
+static int	statnext;
+
 static char *nxtarg(struct test*,int);
 static int expr(struct test*,int);
 static int e3(struct test*);
@@ -113,6 +131,7 @@ int b_test(int argc, char *argv[],Shbltin_t *context)
 
 	tdata.av = argv;
 	tdata.ap = 1;
+	test_statcache(1);
 	if(c_eq(cp,'['))
 	{
 		cp = argv[--argc];
@@ -213,6 +232,7 @@ int b_test(int argc, char *argv[],Shbltin_t *context)
 	tdata.ac = argc;
 	exitval = (!expr(&tdata,0));
 done:
+	test_statcache(0);
 	return exitval;
 }
 
@@ -612,7 +632,21 @@ int sh_access(const char *name, int mode)
 	if(mode==X_OK && sh.euserid==0)
 		goto skip;
 	if(sh.userid==sh.euserid && sh.groupid==sh.egroupid)
+	{
+		if(sh.statcache)
+		{
+			/* stat(2) tells if it exists and has the answer for a following -f, -d, etc. */
+			if(mode==F_OK)
+				return test_stat(name,&statb);
+			if(statcached(name,&statb,1) < 0)
+			{
+				sh_stats(STAT_FILEHITS);
+				return -1;
+			}
+			sh_stats(STAT_FILESTATS);
+		}
 		return access(name,mode);
+	}
 #if _lib_setreuid
 	/* swap the real UID to effective, check access then restore */
 	/* first swap real and effective GID, if different */
@@ -697,11 +731,50 @@ static int test_mode(const char *file)
 	return statb.st_mode;
 }
 
+/*
+ * if the result of stat() for <name> is in the cache, copy it to <buff>
+ * and return 0, or return -1 if stat() failed; otherwise return <mode>
+ */
+static int statcached(const char *name,struct stat *buff,int mode)
+{
+	struct Statcache	*cp;
+	for(cp=statcache; cp < &statcache[STATCACHE]; cp++)
+	{
+		if(cp->name && strcmp(cp->name,name)==0)
+		{
+			if(cp->err)
+			{
+				errno = cp->err;
+				return -1;
+			}
+			*buff = cp->statb;
+			return 0;
+		}
+	}
+	return mode;
+}
+
+/*
+ * start caching stat() results if <on> is nonzero, otherwise discard them
+ */
+void test_statcache(int on)
+{
+	struct Statcache	*cp;
+	if(!on)
+		for(cp=statcache; cp < &statcache[STATCACHE]; cp++)
+			if(cp->name)
+				*cp->name = 0;
+	sh.statcache = on;
+}
+
 /*
  * do an fstat() for /dev/fd/n, otherwise stat()
  */
-static int test_stat(const char *name,struct stat *buff)
+int test_stat(const char *name,struct stat *buff)
 {
+	struct Statcache	*cp;
+	size_t			n;
+	int			r;
 	if(*name==0)
 	{
 		errno = ENOENT;
@@ -709,6 +782,24 @@ static int test_stat(const char *name,struct stat *buff)
 	}
 	if(sh_isdevfd(name))
 		return fstat((int)strtol(name+8, NULL, 10),buff);
-	else
+	if(!sh.statcache)
 		return stat(name,buff);
+	if((r = statcached(name,buff,1)) <= 0)
+	{
+		sh_stats(STAT_FILEHITS);
+		return r;
+	}
+	sh_stats(STAT_FILESTATS);
+	r = stat(name,buff);
+	cp = &statcache[statnext];
+	statnext = (statnext+1)%STATCACHE;
+	if((n = strlen(name)+1) > cp->size)
+	{
+		cp->name = sh_newof(cp->name,char,n,0);
+		cp->size = n;
+	}
+	memcpy(cp->name,name,n);
+	cp->err = r<0 ? errno : 0;
+	cp->statb = *buff;
+	return r;
 }
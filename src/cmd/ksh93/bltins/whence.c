@@ -51,7 +51,7 @@ static int whence(char**, int);
  */
 int	b_command(int argc,char *argv[],Shbltin_t *context)
 {
-	int n, flags=0;
+	int n, flags=0, jobs=0;
 	opt_info.index = opt_info.offset = 0;
 	while((n = optget(argv,sh_optcommand))) switch(n)
 	{
@@ -72,6 +72,16 @@ int	b_command(int argc,char *argv[],Shbltin_t *context)
 	    case 'x':
 		flags |= P_FLAG;
 		break;
+	    case 'P':
+		if(opt_info.num < 1)
+		{
+			if(argc==0)
+				return 0;
+			errormsg(SH_DICT,2,"%s: invalid number of jobs",opt_info.arg);
+		}
+		else
+			jobs = opt_info.num;
+		break;
 	    case ':':
 		if(argc==0)
 			return 0;
@@ -89,7 +99,11 @@ int	b_command(int argc,char *argv[],Shbltin_t *context)
 		if((flags & (X_FLAG|V_FLAG)) || !*argv)
 			return 0;	/* return no offset now; sh_exec() will treat command -v/-V/(null) as normal builtin */
 		if(flags & P_FLAG)
+		{
 			sh_onstate(SH_XARG);
+			if(jobs)
+				sh.xargjobs = jobs;
+		}
 		return opt_info.index; /* offset for sh_exec() to remove 'command' prefix + options */
 	}
 	if(error_info.errors)
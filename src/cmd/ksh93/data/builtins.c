@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1982-2012 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2024 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -140,6 +140,7 @@ const struct shtable3 shtab_builtins[] =
 	CMDLIST(date)
 	CMDLIST(expr)
 	CMDLIST(fds)
+	CMDLIST(find)
 	CMDLIST(fmt)
 	CMDLIST(fold)
 	CMDLIST(head)
@@ -155,6 +156,7 @@ const struct shtable3 shtab_builtins[] =
 	CMDLIST(rev)
 	CMDLIST(rm)
 	CMDLIST(rmdir)
+	CMDLIST(sort)
 	CMDLIST(stty)
 	CMDLIST(sum)
 	CMDLIST(sync)
@@ -178,6 +180,12 @@ const struct shtable3 shtab_builtins[] =
 	CMDLIST(vmstate)  /* vmstate only works with vmalloc */
 #endif
 #endif
+/*
+ * ksh-specific builtins that are bound to the path so they never shadow
+ * an external command of the same name
+ */
+	SH_CMDLIB_DIR "/filestat",	NV_BLTIN|BLT_ENV|NV_NOFREE,	bltin(filestat),
+	SH_CMDLIB_DIR "/memstat",	NV_BLTIN|BLT_ENV|NV_NOFREE,	bltin(memstat),
 #if SHOPT_REGRESS
 	"__regress__",		NV_BLTIN|BLT_ENV,	bltin(__regress__),
 #endif
@@ -285,6 +293,13 @@ const char sh_set[] =
 		"[+ignoreeof?Prevents an interactive shell from exiting on "
 			"reading an end-of-file.]"
 #endif
+		"[+jsontrace?After each simple command, write a line with a JSON "
+			"object describing it to the file descriptor given by "
+			"\bKSH_TRACEFD\b (default 2). The members are \bt\b "
+			"(start time on a monotonic clock in nanoseconds), \bdur\b "
+			"(duration in nanoseconds), \bpid\b, \bsub\b (subshell "
+			"level), \bline\b, \bfunc\b, \bargv\b and \bstatus\b "
+			"(\bnull\b if not waited for). Output is buffered.]"
 		"[+keyword?Equivalent to \b-k\b.]"
 		"[+letoctal?The \blet\b builtin recognizes octal constants "
 			"with leading 0.]"
@@ -306,6 +321,14 @@ const char sh_set[] =
 			"be zero if all commands return zero exit status.]"
 		"[+posix?Enable full POSIX standard compliance mode.]"
 		"[+privileged?Equivalent to \b-p\b.]"
+#if SHOPT_PROFILER
+		"[+profile?Record the wall clock and CPU time spent on each "
+			"line of each function and dot script, and the number of "
+			"processes started there. On exit, the profile is appended "
+			"to the file named by \bKSH_PROFILE\b, or written to "
+			"standard error, in the collapsed stack format used by "
+			"flame graph tools.]"
+#endif
 		"[+showme?Simple commands preceded by a \b;\b will be traced "
 			"as if \b-x\b were enabled but not executed.]"
 		"[+trackall?Equivalent to \b-h\b.]"
@@ -550,7 +573,7 @@ const char sh_optcd[] =
 ;
 
 const char sh_optcommand[] =
-"[-1c?\n@(#)$Id: command (ksh 93u+m) 2023-03-20 $\n]"
+"[-1c?\n@(#)$Id: command (ksh 93u+m) 2026-10-18 $\n]"
 "[--catalog?" SH_DICT "]"
 "[+NAME?command - execute a simple command disabling special properties]"
 "[+DESCRIPTION?Without \b-v\b or \b-V\b, \bcommand\b executes \acmd\a "
@@ -581,6 +604,9 @@ const char sh_optcommand[] =
 	"as well as any that follow the last such word, "
 	"will be repeated for each invocation "
 	"so as to allow all invocations to use the same command options.]"
+"[P?With \b-x\b, run up to \ajobs\a invocations of \acmd\a "
+	"concurrently, dividing the \aarg\as into at least \ajobs\a "
+	"invocations of similar size.]#[jobs]"
 "\n"
 "\n[cmd [arg ...]]\n"
 "\n"
@@ -733,6 +759,47 @@ const char sh_optexport[] =
 "[+SEE ALSO?\bsh\b(1), \btypeset\b(1)]"
 ;
 
+const char sh_optfilestat[] =
+"[-1c?\n@(#)$Id: filestat (ksh 93u+m) 2026-10-18 $\n]"
+"[--catalog?" SH_DICT "]"
+"[+NAME?filestat - get the attributes of files]"
+"[+DESCRIPTION?\bfilestat\b unsets \avar\a and sets it to an indexed array "
+	"with one compound variable for each \afile\a operand, in the order "
+	"given, containing the attributes of that file. As the files are "
+	"examined without creating a process, this is much faster than "
+	"running \bls\b(1) or \bstat\b(1) for each file. The following "
+	"members are set:]"
+"{"
+	"[+name?The \afile\a operand.]"
+	"[+type?One of \bregular\b, \bdirectory\b, \bsymlink\b, \bfifo\b, "
+		"\bsocket\b, \bcharacter\b or \bblock\b.]"
+	"[+mode?The permission bits as an octal number.]"
+	"[+perms?The type and permissions as shown by \bls -l\b.]"
+	"[+nlink?The number of hard links.]"
+	"[+uid, gid?The numeric owner and group IDs.]"
+	"[+user, group?The owner and group names.]"
+	"[+size?The size in bytes.]"
+	"[+blocks?The number of blocks allocated.]"
+	"[+dev, ino?The device and inode numbers.]"
+	"[+atime, mtime, ctime?The times of last access, modification and "
+		"status change, in seconds since the epoch with nine decimals.]"
+	"[+target?With \b-P\b, the contents of a symbolic link.]"
+"}"
+"[+?If the attributes of a file cannot be obtained, its element has only "
+	"the members \bname\b and \berror\b, the latter set to the error "
+	"message, and a diagnostic is written to standard error.]"
+"[A?Create an associative array indexed by the \afile\a operands instead.]"
+"[P?Do not follow symbolic links; get the attributes of the links themselves.]"
+"\n"
+"\nvar file ...\n"
+"\n"
+"[+EXIT STATUS?]{"
+	"[+0?The attributes of all files were obtained.]"
+	"[+>0?An error occurred.]"
+"}"
+"[+SEE ALSO?\bls\b(1), \bstat\b(2), \btest\b(1)]"
+;
+
 const char sh_optgetopts[] =
 ":[-1c?\n@(#)$Id: getopts (AT&T Research) 2005-01-01 $\n]"
 "[-author?Glenn Fowler <gsf@research.att.com>]"
@@ -1197,6 +1264,43 @@ const char sh_optlet[]	=
 "[+SEE ALSO?\bexpr\b(1), \btest\b(1), \bksh\b(1)]"
 ;
 
+const char sh_optmemstat[] =
+"[-1c?\n@(#)$Id: memstat (ksh 93u+m) 2026-10-18 $\n]"
+"[--catalog?" SH_DICT "]"
+"[+NAME?memstat - report the memory used by the shell's data structures]"
+"[+DESCRIPTION?\bmemstat\b writes one line for each of the following "
+	"categories of memory held by the current shell, giving its name, "
+	"the number of objects in it and the number of bytes they hold. "
+	"If \acategory\a operands are given, only those categories are "
+	"written. The figures are found by walking the data structures, so "
+	"they do not depend on the \bmalloc\b(3) implementation and do not "
+	"include its overhead.]"
+"{"
+	"[+variables?Global variables: their nodes and scalar values.]"
+	"[+locals?Variables in the scopes of the running functions.]"
+	"[+arrays?Array elements: their value storage and, for "
+		"associative arrays, their nodes.]"
+	"[+functions?Defined functions and their parse trees.]"
+	"[+aliases?Aliases and their values.]"
+	"[+tracked?Tracked aliases (see \bhash\b).]"
+	"[+stack?Frames of the stack for expansions and other temporary "
+		"data, including freed frames kept for reuse.]"
+	"[+sfio?Open shell streams and their buffers.]"
+	"[+regex?Compiled regular expressions in the pattern cache.]"
+	"[+history?Commands accessible in the history list and the memory "
+		"used to index them; the history file is not counted.]"
+	"[+total?The sum of the above.]"
+"}"
+"\n"
+"\n[category ...]\n"
+"\n"
+"[+EXIT STATUS?]{"
+	"[+0?Successful completion.]"
+	"[+>0?An error occurred.]"
+"}"
+"[+SEE ALSO?\btypeset\b(1)]"
+;
+
 const char sh_optprint[] =
 "[-1c?\n@(#)$Id: print (ksh 93u+m) 2022-09-26 $\n]"
 "[--catalog?" SH_DICT "]"
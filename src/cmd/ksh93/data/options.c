@@ -63,6 +63,7 @@ const Shtable_t shtab_options[] =
 #endif
 	"ignoreeof",			SH_IGNOREEOF,
 	"interactive",			SH_INTERACTIVE|SH_COMMANDLINE,
+	"jsontrace",			SH_JSONTRACE,
 	"keyword",			SH_KEYWORD,
 	"letoctal",			SH_LETOCTAL,
 	"nolog",			SH_NOLOG,
@@ -76,6 +77,9 @@ const Shtable_t shtab_options[] =
 	"pipefail",			SH_PIPEFAIL,
 	"posix",			SH_POSIX,
 	"privileged",			SH_PRIVILEGED,
+#if SHOPT_PROFILER
+	"profile",			SH_PROFILING,
+#endif
 	"rc",				SH_RC|SH_COMMANDLINE,
 	"restricted",			SH_RESTRICTED,
 	"showme",			SH_SHOWME,
@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1982-2012 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2024 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -101,6 +101,7 @@ const struct shtable2 shtab_variables[] =
 	".sh.pid",	NV_PID|NV_NOFREE,		NULL,
 	".sh.ppid",	NV_PID|NV_NOFREE,		NULL,
 	".sh.tilde",	0,				NULL,
+	".sh.readahead",NV_NOFREE|NV_INTEGER,		NULL,
 	"SHLVL",	NV_INTEGER|NV_NOFREE|NV_EXPORT,	NULL,
 	"SRANDOM",	NV_NOFREE|NV_INTEGER|NV_UNSIGN,	NULL,
 	"",	0,					NULL
@@ -113,18 +114,34 @@ const Shtable_t shtab_stats[] =
 {
 	"arg_cachehits",	STAT_ARGHITS,
 	"arg_expands",		STAT_ARGEXPAND,
+	"builtin_calls",	STAT_BLTCALLS,
+	"builtin_usec",		STAT_BLTUSEC,
+	"bytesread",		STAT_RBYTES,
+	"byteswritten",		STAT_WBYTES,
+	"comsub_forks",		STAT_COMSUBFORK,
 	"comsubs",		STAT_COMSUB,
+	"file_cachehits",	STAT_FILEHITS,
+	"file_stats",		STAT_FILESTATS,
+	"fork_latency",		STAT_FORKHIST,
 	"forks",		STAT_FORKS,
 	"funcalls",		STAT_FUNCT,
 	"globs",		STAT_GLOBS,
 	"linesread",		STAT_READS,
 	"nv_cachehit",		STAT_NVHITS,
+	"nv_nodes",		STAT_NVNODES,
 	"nv_opens",		STAT_NVOPEN,
+	"path_misses",		STAT_PATHMISS,
 	"pathsearch",		STAT_PATHS,
 	"posixfuncall",		STAT_SVFUNCT,
+	"regcomps",		STAT_REGCOMP,
 	"simplecmds",		STAT_SCMDS,
+	"spawn_latency",	STAT_SPAWNHIST,
 	"spawns",		STAT_SPAWN,
-	"subshell",		STAT_SUBSHELL
+	"stack_allocs",		STAT_STKALLOCS,
+	"stack_peak",		STAT_STKPEAK,
+	"subshell",		STAT_SUBSHELL,
+	"tmpfiles",		STAT_TMPFILES,
+	"",			0
 };
 #endif /* SHOPT_STATS */
 
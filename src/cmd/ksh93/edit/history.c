@@ -390,6 +390,15 @@ void hist_close(History_t *hp)
 #endif /* SHOPT_ACCTFILE */
 }
 
+/*
+ * return the number of bytes of memory used by the history
+ * the history file itself is not counted
+ */
+size_t hist_memsize(History_t *hp)
+{
+	return sizeof(History_t) + hp->histmask*sizeof(off_t) + sizeof(Sfio_t) + strlen(hp->histname) + 1;
+}
+
 /*
  * check history file format to see if it begins with special byte
  */
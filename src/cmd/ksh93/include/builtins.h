@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1982-2012 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2024 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -93,6 +93,8 @@ extern int b_eloop(int, char*[],Shbltin_t*);
 #endif /* SHOPT_MKSERVICE */
 extern int b_hist(int, char*[],Shbltin_t*);
 extern int b_let(int, char*[],Shbltin_t*);
+extern int b_filestat(int, char*[],Shbltin_t*);
+extern int b_memstat(int, char*[],Shbltin_t*);
 extern int b_read(int, char*[],Shbltin_t*);
 extern int b_ulimit(int, char*[],Shbltin_t*);
 extern int b_umask(int, char*[],Shbltin_t*);
@@ -178,6 +180,8 @@ extern const char sh_optstop[];
 extern const char sh_optsuspend[];
 extern const char sh_optksh[];
 extern const char sh_optlet[];
+extern const char sh_optfilestat[];
+extern const char sh_optmemstat[];
 extern const char sh_optprint[];
 extern const char sh_optprintf[];
 extern const char sh_optpwd[];
@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1982-2012 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2024 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -144,7 +144,10 @@ extern int		sh_subsavefd(int);
 extern void		sh_subtmpfile(void);
 extern char 		*sh_substitute(const char*,const char*,char*);
 extern void		sh_timetraps(void);
+extern Sfulong_t	sh_monotime(void);
 extern const char	*_sh_translate(const char*);
+extern void		sh_jtraceopen(void);
+extern void		sh_jtracesync(void);
 extern int		sh_trace(char*[],int);
 extern void		sh_trim(char*);
 extern int		sh_type(const char*);
@@ -233,10 +236,76 @@ extern const char	e_scriptonly[];
 #   define	STAT_SCMDS	11
 #   define	STAT_SPAWN	12
 #   define	STAT_SUBSHELL	13
+#   define	STAT_COMSUBFORK	14
+#   define	STAT_TMPFILES	15
+#   define	STAT_REGCOMP	16
+#   define	STAT_PATHMISS	17
+#   define	STAT_FILESTATS	18
+#   define	STAT_FILEHITS	19
+#   define	STAT_NCOUNT	20	/* number of int counters in sh.stats */
+    /* members of .sh.stats kept in sh_xstats */
+#   define	STAT_BLTCALLS	20
+#   define	STAT_BLTUSEC	21
+#   define	STAT_RBYTES	22
+#   define	STAT_WBYTES	23
+#   define	STAT_FORKHIST	24
+#   define	STAT_SPAWNHIST	25
+#   define	STAT_STKPEAK	26
+#   define	STAT_STKALLOCS	27
+#   define	STAT_NVNODES	28
+#   define	STAT_NSTATS	29
+#   define	STAT_NHIST	5	/* latency buckets: <10us <100us <1ms <10ms >=10ms */
+    /* statistics that do not fit in an int counter in sh.stats */
+    struct Shstats
+    {
+	Sflong_t	rbytes;		/* bytes read by the read built-in */
+	Sflong_t	wbytes;		/* bytes written by print, printf and echo */
+	unsigned int	*bltcalls;	/* calls of each entry of shtab_builtins */
+	Sfulong_t	*bltns;		/* nanoseconds spent in each of them */
+	int		nbltins;
+	unsigned int	forkhist[STAT_NHIST];	/* fork(2) latency */
+	unsigned int	spawnhist[STAT_NHIST];	/* posix_spawn(2) latency */
+	unsigned long	regbase;	/* regcachecomps() when last reset */
+	Sflong_t	stkpeak;	/* high-water mark of sh.stk in bytes */
+	Sflong_t	stkallocs;	/* sh.stk frames allocated */
+    };
+    extern struct Shstats	sh_xstats;
     extern const Shtable_t shtab_stats[];
+    extern void		sh_statlatency(unsigned int*, Sfulong_t);
 #   define sh_stats(x)	(sh.stats[(x)]++)
+#   define sh_statsadd(x,n)	(sh_xstats.x += (n))
+#   define sh_statstime()	sh_monotime()
+#   define sh_statshist(x,t)	sh_statlatency(sh_xstats.x,(t))
 #else
 #   define sh_stats(x)
+#   define sh_statsadd(x,n)
+#   define sh_statstime()	0
+#   define sh_statshist(x,t)	NOT_USED(t)
 #endif /* SHOPT_STATS */
 
+#if SHOPT_PROFILER
+    /* execution profiler (set -o profile) */
+#   define	PROF_FORK	0
+#   define	PROF_SPAWN	1
+    extern void		sh_profstart(void);
+    extern void		sh_profdone(void);
+    extern void		_sh_profline(int);
+    extern void		_sh_proffork(const Shnode_t*);
+    extern void		_sh_profcall(const char*, const char*, int);
+    extern void		_sh_profreturn(void);
+    extern void		_sh_profcount(int);
+#   define sh_profline()	(sh_isoption(SH_PROFILING) ? _sh_profline(error_info.line) : (void)0)
+#   define sh_proffork(t)	(sh_isoption(SH_PROFILING) ? _sh_proffork(t) : (void)0)
+#   define sh_profcall(n,f,l)	(sh_isoption(SH_PROFILING) ? _sh_profcall(n,f,l) : (void)0)
+#   define sh_profreturn()	(sh_isoption(SH_PROFILING) ? _sh_profreturn() : (void)0)
+#   define sh_profcount(x)	(sh_isoption(SH_PROFILING) ? _sh_profcount(x) : (void)0)
+#else
+#   define sh_profline()
+#   define sh_proffork(t)
+#   define sh_profcall(n,f,l)
+#   define sh_profreturn()
+#   define sh_profcount(x)
+#   define sh_profdone()
+#endif /* SHOPT_PROFILER */
+
 #endif /* !defs_h_defined */
@@ -106,8 +106,18 @@ struct Ufunction
 	Dt_t		*sdict;		/* dictionary for statics */
 	Dt_t		*fdict;		/* dictionary node belongs to */
 	Namval_t	*np;		/* function node pointer */
+	size_t		treesize;	/* bytes in parse tree stack */
 };
 
+/* statistics of a slab pool of nodes created by nv_search() */
+#define NV_NSLAB	8	/* size classes, SLAB_ALIGN bytes apart */
+typedef struct Nvslab_s
+{
+	size_t		size;		/* bytes per node, including the name */
+	size_t		live;		/* nodes in use */
+	size_t		slabs;		/* slabs allocated */
+} Nvslab_t;
+
 #ifndef ARG_RAW
     struct argnod;
 #endif /* !ARG_RAW */
@@ -214,6 +224,10 @@ extern Namval_t		*nv_arraychild(Namval_t*, Namval_t*, int);
 extern int		nv_compare(Dt_t*, void*, void*, Dtdisc_t*);
 extern void		nv_outnode(Namval_t*,Sfio_t*, int, int);
 extern int		nv_subsaved(Namval_t*, int);
+extern void		nv_freenode(Namval_t*);
+extern const Nvslab_t	*nv_slabstat(void);
+extern size_t		nv_nodesize(Namval_t*);
+extern size_t		nv_memsize(Namval_t*, size_t*);
 extern void		nv_typename(Namval_t*, Sfio_t*);
 extern void		nv_newtype(Namval_t*);
 extern int		nv_istable(Namval_t*);
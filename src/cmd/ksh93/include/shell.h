@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1982-2012 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2024 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -146,6 +146,10 @@ typedef union Shnode_u Shnode_t;
 #endif
 #endif
 #define SH_POSIX	46
+#if SHOPT_PROFILER
+#define SH_PROFILING	49
+#endif
+#define SH_JSONTRACE	50
 #if SHOPT_ESH || SHOPT_VSH
 #define SH_MULTILINE	47
 #define SH_NOBACKSLCTRL	48
@@ -347,6 +351,7 @@ struct Shell_s
 	int		xargmin;
 	int		xargmax;
 	int		xargexit;
+	int		xargjobs;	/* command -x -P concurrent invocations */
 	int		save_env_n;	/* number of saved pointers to environment variables with invalid names */
 	char		**save_env;	/* saved pointers to environment variables with invalid names */
 	mode_t		mask;
@@ -357,6 +362,7 @@ struct Shell_s
 	void		*pathlist;
 	void		*cdpathlist;
 	char		cond_expan;	/* set while processing ${var=val}, ${var:=val}, ${var?err}, ${var:?err} */
+	char		statcache;	/* set while test operators may reuse stat(2) results; see bltins/test.c */
 	struct sh_scoped global;
 	struct checkpt	checkbase;
 	Shinit_f	userinit;
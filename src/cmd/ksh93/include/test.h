@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1982-2011 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2023 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -55,7 +55,9 @@
 
 extern int test_unop(int, const char*);
 extern int test_inode(const char*, const char*);
+extern int test_stat(const char*, struct stat*);
 extern int test_binop(int, const char*, const char*);
+extern void test_statcache(int);
 
 extern const char	sh_opttest[];
 extern const char	test_opchars[];
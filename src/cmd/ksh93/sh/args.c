@@ -393,6 +393,15 @@ static void applyopts(Shopt_t newflags)
 		sh_onstate(SH_MONITOR);
 	else if(sh_isoption(SH_MONITOR) && !is_option(&newflags,SH_MONITOR))
 		sh_offstate(SH_MONITOR);
+	if(!sh_isoption(SH_JSONTRACE) && is_option(&newflags,SH_JSONTRACE))
+		sh_jtraceopen();
+	else if(sh_isoption(SH_JSONTRACE) && !is_option(&newflags,SH_JSONTRACE))
+		sh_jtracesync();
+#if SHOPT_PROFILER
+	/* resume profiling without charging the time it was off */
+	if(!sh_isoption(SH_PROFILING) && is_option(&newflags,SH_PROFILING))
+		sh_profstart();
+#endif /* SHOPT_PROFILER */
 	sh.options = newflags;
 }
 
@@ -1830,3 +1830,78 @@ void nv_setvec(Namval_t *np,int append,int argc,char *argv[])
 		nv_putval(np,argv[argc],0);
 	}
 }
+
+/*
+ * return the number of bytes held by the value <up> of a variable or
+ * array element with the attributes of <np>
+ */
+static size_t valsize(Namval_t *np, union Value *up)
+{
+	if(!up->cp || up->cp==Empty)
+		return 0;
+	if(nv_isattr(np,NV_INTEGER))
+	{
+		if(nv_isattr(np,NV_INT16P|NV_DOUBLE)==NV_INT16)
+			return 0;	/* stored in the value holder */
+		return nv_datasize(np,NULL);
+	}
+	if(nv_isattr(np,NV_BINARY))
+		return nv_size(np);
+	return strlen(up->cp)+1;
+}
+
+/*
+ * return the number of bytes held by the value of <np>, including its
+ * array elements and their nodes, and add the number of elements to
+ * <count>; values that are not owned by <np> are not counted
+ */
+size_t nv_memsize(Namval_t *np, size_t *count)
+{
+	Namarr_t	*arp;
+	Namval_t	*mp;
+	Dt_t		*view;
+	size_t		bytes = 0;
+	int		i;
+	if(nv_isattr(np,NV_NOFREE|NV_REF|NV_TABLE) || is_afunction(np))
+		return 0;
+	if(!(arp = nv_arrayptr(np)))
+		return np->nvfun ? 0 : valsize(np,&np->nvalue);
+#if SHOPT_FIXEDARRAY
+	if(arp->fixed)
+	{
+		struct fixed_array *fp = (struct fixed_array*)arp->fixed;
+		*count += fp->nelem;
+		return sizeof(struct fixed_array) + (size_t)fp->nelem*fp->size;
+	}
+#endif /* SHOPT_FIXEDARRAY */
+	if(is_associative(arp))
+	{
+		bytes = arp->hdr.dsize;
+		if(arp->fun!=nv_associative || !arp->table)
+			return bytes;
+		view = dtview(arp->table,NULL);
+		for(mp=(Namval_t*)dtfirst(arp->table); mp; mp=(Namval_t*)dtnext(arp->table,mp))
+		{
+			(*count)++;
+			bytes += nv_nodesize(mp) + nv_memsize(mp,count);
+		}
+		if(view)
+			dtview(arp->table,view);
+	}
+	else
+	{
+		struct index_array *ap = (struct index_array*)arp;
+		bytes = sizeof(struct index_array) + (ap->maxi-1)*sizeof(union Value) + ap->maxi;
+		for(i=0; i < ap->maxi; i++)
+		{
+			if(!ap->val[i].cp)
+				continue;
+			(*count)++;
+			if(array_isbit(ap->bits,i,ARRAY_CHILD))
+				bytes += sizeof(Namval_t) + nv_memsize(ap->val[i].np,count);
+			else if(!array_isbit(ap->bits,i,ARRAY_NOFREE))
+				bytes += valsize(np,&ap->val[i]);
+		}
+	}
+	return bytes;
+}
@@ -675,6 +675,8 @@ noreturn void sh_done(int sig)
 		sh_chktrap();
 	}
 	nv_scan(sh.var_tree,array_notify,NULL,NV_ARRAY,NV_ARRAY);
+	sh_profdone();
+	sh_jtracesync();
 	sh_freeup();
 #if SHOPT_ACCT
 	sh_accend();
@@ -209,6 +209,7 @@ typedef struct _init_
 	Namfun_t	SH_VERSION_init;
 	struct match	SH_MATCH_init;
 	Namfun_t	SH_MATH_init;
+	Namfun_t	SH_READAHEAD_init;
 	Namfun_t	LC_TYPE_init;
 	Namfun_t	LC_TIME_init;
 	Namfun_t	LC_NUM_init;
@@ -743,6 +744,39 @@ static char* get_srand(Namval_t* np, Namfun_t *fp)
 	return fmtint(n,1);
 }
 
+/*
+ * The following three functions are for .sh.readahead, the cap in bytes up to
+ * which sfio grows the buffer of a regular file being read sequentially
+ */
+
+static void put_readahead(Namval_t* np,const char *val,int flags,Namfun_t *fp)
+{
+	Sfdouble_t d;
+	if(!val)  /* unset */
+	{
+		fp = nv_stack(np, NULL);
+		if(fp && !fp->nofree)
+			free(fp);
+		_nv_unset(np,NV_RDONLY);
+		return;
+	}
+	if(flags&NV_INTEGER)
+		d = *(Sfdouble_t*)val;
+	else
+		d = sh_arith(val);
+	sfmaxbuf(d > 0 ? (ssize_t)d : 0, 1);
+}
+
+static Sfdouble_t nget_readahead(Namval_t* np, Namfun_t *fp)
+{
+	return (Sfdouble_t)sfmaxbuf(0,0);
+}
+
+static char* get_readahead(Namval_t* np, Namfun_t *fp)
+{
+	return fmtint((intmax_t)sfmaxbuf(0,0),0);
+}
+
 /*
  * These three routines are for LINENO
  */
@@ -1055,6 +1089,7 @@ static const Namdisc_t OPTINDEX_disc	= {  sizeof(Namfun_t), put_optindex, 0, nge
 static const Namdisc_t SECONDS_disc	= {  sizeof(Namfun_t), put_seconds, get_seconds, nget_seconds };
 static const Namdisc_t RAND_disc	= {  sizeof(struct rand), put_rand, get_rand, nget_rand };
 static const Namdisc_t SRAND_disc	= {  sizeof(Namfun_t), put_srand, get_srand, nget_srand };
+static const Namdisc_t READAHEAD_disc	= {  sizeof(Namfun_t), put_readahead, get_readahead, nget_readahead };
 static const Namdisc_t LINENO_disc	= {  sizeof(Namfun_t), put_lineno, get_lineno, nget_lineno };
 static const Namdisc_t L_ARG_disc	= {  sizeof(Namfun_t), put_lastarg, get_lastarg };
 
@@ -1420,6 +1455,18 @@ Shell_t *sh_init(int argc,char *argv[], Shinit_f userinit)
 #if (SHOPT_ESH || SHOPT_VSH)
 	sh_onoption(SH_MULTILINE);
 #endif
+#if SHOPT_PROFILER
+	{
+		/* profile scripts without editing them if KSH_PROFILE is exported */
+		Namval_t *np = nv_search("KSH_PROFILE",sh.var_tree,0);
+		char *cp;
+		if(np && nv_isattr(np,NV_EXPORT) && (cp = nv_getval(np)) && *cp)
+		{
+			sh_onoption(SH_PROFILING);
+			sh_profstart();
+		}
+	}
+#endif /* SHOPT_PROFILER */
 	if(argc>0)
 	{
 		int dolv_index;
@@ -1717,22 +1764,158 @@ Namfun_t *nv_cover(Namval_t *np)
 }
 
 #if SHOPT_STATS
+struct Shstats	sh_xstats;
+
 struct Stats
 {
 	Namfun_t	hdr;
-	char		*nodes;
+	Namval_t	*nodes;
 	int		numnodes;
 	int		current;
 };
 
+static char *name_stat(Namval_t *np, Namfun_t *fp)
+{
+	sfprintf(sh.strbuf,".sh.stats.%s",np->nvname);
+	return sfstruse(sh.strbuf);
+}
+
+static const Namdisc_t	stat_child_disc =
+{
+	0,0,0,0,0,0,0,
+	name_stat
+};
+
+static Namfun_t	 stat_child_fun =
+{
+	&stat_child_disc, 1, 0, sizeof(Namfun_t)
+};
+
+/*
+ * add the time elapsed since <start> to latency histogram <hist>
+ */
+void sh_statlatency(unsigned int *hist, Sfulong_t start)
+{
+	Sfulong_t	ns = sh_monotime() - start;
+	int		i;
+	for(i=0; i < STAT_NHIST-1 && ns >= 10000; i++)
+		ns /= 10;
+	hist[i]++;
+}
+
+/*
+ * empty an array member of .sh.stats before it is refilled
+ */
+static void stat_clear(Namval_t *np)
+{
+	nv_offattr(np,NV_RDONLY);
+	if(nv_isarray(np))
+		nv_putsub(np,NULL,ARRAY_UNDEF);
+	nv_unset(np);
+	np->nvfun = &stat_child_fun;
+}
+
+/*
+ * copy the counters that are not kept in sh.stats into their nodes
+ */
+static void stat_refresh(struct Stats *sp)
+{
+	Namval_t	*np;
+	int		i,j;
+	char		*cp;
+	Stkstat_t	st;
+	sh.stats[STAT_REGCOMP] = (int)(regcachecomps() - sh_xstats.regbase);
+	stkstat(sh.stk,&st,0);
+	sh_xstats.stkpeak = st.peak;
+	sh_xstats.stkallocs = st.allocs;
+	for(i=0; i < sp->numnodes; i++)
+	{
+		np = &sp->nodes[i];
+		switch(shtab_stats[i].sh_number)
+		{
+		    case STAT_BLTCALLS:
+		    case STAT_BLTUSEC:
+			stat_clear(np);
+			for(j=0; j < sh_xstats.nbltins; j++)
+			{
+				if(!sh_xstats.bltcalls[j])
+					continue;
+				if(!nv_arrayptr(np))
+					nv_setarray(np,nv_associative);
+				nv_putsub(np,sh.bltin_cmds[j].nvname,ARRAY_ADD);
+				if(shtab_stats[i].sh_number==STAT_BLTCALLS)
+					cp = fmtint(sh_xstats.bltcalls[j],1);
+				else
+					cp = fmtint(sh_xstats.bltns[j]/1000,1);
+				nv_putval(np,cp,0);
+			}
+			nv_onattr(np,NV_RDONLY|NV_MINIMAL);
+			break;
+		    case STAT_NVNODES:
+		    {
+			/* copy, as filling in the array creates nodes */
+			Nvslab_t sl[NV_NSLAB];
+			memcpy(sl,nv_slabstat(),sizeof(sl));
+			stat_clear(np);
+			for(j=0; j < NV_NSLAB; j++)
+			{
+				if(!sl[j].live)
+					continue;
+				if(!nv_arrayptr(np))
+					nv_setarray(np,nv_associative);
+				nv_putsub(np,fmtint(sl[j].size,1),ARRAY_ADD);
+				nv_putval(np,fmtint(sl[j].live,1),0);
+			}
+			nv_onattr(np,NV_RDONLY|NV_MINIMAL);
+			break;
+		    }
+		    case STAT_FORKHIST:
+		    case STAT_SPAWNHIST:
+			stat_clear(np);
+			for(j=0; j < STAT_NHIST; j++)
+			{
+				nv_putsub(np,NULL,j|ARRAY_ADD);
+				if(shtab_stats[i].sh_number==STAT_FORKHIST)
+					cp = fmtint(sh_xstats.forkhist[j],1);
+				else
+					cp = fmtint(sh_xstats.spawnhist[j],1);
+				nv_putval(np,cp,0);
+			}
+			nv_onattr(np,NV_RDONLY|NV_MINIMAL);
+			break;
+		}
+	}
+}
+
+/*
+ * reset all counters
+ */
+static void stat_reset(void)
+{
+	memset(sh.stats,0,STAT_NCOUNT*sizeof(int));
+	sh_xstats.rbytes = sh_xstats.wbytes = 0;
+	if(sh_xstats.nbltins)
+	{
+		memset(sh_xstats.bltcalls,0,sh_xstats.nbltins*sizeof(unsigned int));
+		memset(sh_xstats.bltns,0,sh_xstats.nbltins*sizeof(Sfulong_t));
+	}
+	memset(sh_xstats.forkhist,0,sizeof(sh_xstats.forkhist));
+	memset(sh_xstats.spawnhist,0,sizeof(sh_xstats.spawnhist));
+	sh_xstats.regbase = regcachecomps();
+	stkstat(sh.stk,NULL,1);
+}
+
 static Namval_t *next_stat(Namval_t* np, Dt_t *root,Namfun_t *fp)
 {
 	struct Stats *sp = (struct Stats*)fp;
 	if(!root)
+	{
+		stat_refresh(sp);
 		sp->current = 0;
+	}
 	else if(++sp->current>=sp->numnodes)
 		return NULL;
-	return nv_namptr(sp->nodes,sp->current);
+	return &sp->nodes[sp->current];
 }
 
 static Namval_t *create_stat(Namval_t *np,const char *name,int flag,Namfun_t *fp)
@@ -1747,7 +1930,7 @@ static Namval_t *create_stat(Namval_t *np,const char *name,int flag,Namfun_t *fp
 	n = (cp-1) -name;
 	for(i=0; i < sp->numnodes; i++)
 	{
-		nq = nv_namptr(sp->nodes,i);
+		nq = &sp->nodes[i];
 		if((n==0||strncmp(name,nq->nvname,n)==0) && nq->nvname[n]==0)
 			goto found;
 	}
@@ -1755,6 +1938,7 @@ static Namval_t *create_stat(Namval_t *np,const char *name,int flag,Namfun_t *fp
 found:
 	if(nq)
 	{
+		stat_refresh(sp);
 		fp->last = (char*)&name[n];
 		sh.last_table = SH_STATS;
 	}
@@ -1766,54 +1950,92 @@ found:
 	return nq;
 }
 
+/*
+ * assigning an empty value to .sh.stats resets the counters
+ */
+static void put_stat(Namval_t *np,const char *val,int flags,Namfun_t *fp)
+{
+	if(val && !*val)
+	{
+		stat_reset();
+		return;
+	}
+	nv_putv(np,val,flags,fp);
+}
+
 static const Namdisc_t stat_disc =
 {
-	0, 0, 0, 0, 0,
+	0,
+	put_stat,
+	0, 0, 0,
 	create_stat,
 	0, 0,
 	next_stat
 };
 
-static char *name_stat(Namval_t *np, Namfun_t *fp)
-{
-	sfprintf(sh.strbuf,".sh.stats.%s",np->nvname);
-	return sfstruse(sh.strbuf);
-}
-
-static const Namdisc_t	stat_child_disc =
-{
-	0,0,0,0,0,0,0,
-	name_stat
-};
-
-static Namfun_t	 stat_child_fun =
-{
-	&stat_child_disc, 1, 0, sizeof(Namfun_t)
-};
-
 static void stat_init(void)
 {
-	int		i,nstat = STAT_SUBSHELL+1;
-	size_t		extrasize = nstat*(sizeof(int)+NV_MINSZ);
+	int		i,nstat = STAT_NSTATS;
+	size_t		extrasize = nstat*sizeof(Namval_t);
 	struct Stats	*sp = sh_newof(0,struct Stats,1,extrasize);
 	Namval_t	*np;
 	sp->numnodes = nstat;
-	sp->nodes = (char*)(sp+1);
-	sh.stats = (int*)sh_calloc(sizeof(int),nstat);
+	sp->nodes = (Namval_t*)(sp+1);
+	sh.stats = (int*)sh_calloc(sizeof(int),STAT_NCOUNT);
+	free(sh_xstats.bltcalls);
+	free(sh_xstats.bltns);
+	for(i=0; *shtab_builtins[i].sh_name; i++);
+	sh_xstats.nbltins = i;
+	sh_xstats.bltcalls = (unsigned int*)sh_calloc(sizeof(unsigned int),i);
+	sh_xstats.bltns = (Sfulong_t*)sh_calloc(sizeof(Sfulong_t),i);
+	stat_reset();
 	for(i=0; i < nstat; i++)
 	{
-		np = nv_namptr(sp->nodes,i);
+		np = &sp->nodes[i];
 		np->nvfun = &stat_child_fun;
 		np->nvname = (char*)shtab_stats[i].sh_name;
-		nv_onattr(np,NV_RDONLY|NV_MINIMAL|NV_NOFREE|NV_INTEGER);
-		nv_setsize(np,10);
-		np->nvalue.ip = &sh.stats[i];
+		switch(shtab_stats[i].sh_number)
+		{
+		    case STAT_BLTCALLS:
+		    case STAT_BLTUSEC:
+		    case STAT_NVNODES:
+		    case STAT_FORKHIST:
+		    case STAT_SPAWNHIST:
+			nv_onattr(np,NV_RDONLY|NV_MINIMAL);
+			break;
+		    case STAT_RBYTES:
+			nv_onattr(np,NV_RDONLY|NV_MINIMAL|NV_NOFREE|NV_INT64);
+			nv_setsize(np,10);
+			np->nvalue.llp = &sh_xstats.rbytes;
+			break;
+		    case STAT_WBYTES:
+			nv_onattr(np,NV_RDONLY|NV_MINIMAL|NV_NOFREE|NV_INT64);
+			nv_setsize(np,10);
+			np->nvalue.llp = &sh_xstats.wbytes;
+			break;
+		    case STAT_STKPEAK:
+			nv_onattr(np,NV_RDONLY|NV_MINIMAL|NV_NOFREE|NV_INT64);
+			nv_setsize(np,10);
+			np->nvalue.llp = &sh_xstats.stkpeak;
+			break;
+		    case STAT_STKALLOCS:
+			nv_onattr(np,NV_RDONLY|NV_MINIMAL|NV_NOFREE|NV_INT64);
+			nv_setsize(np,10);
+			np->nvalue.llp = &sh_xstats.stkallocs;
+			break;
+		    default:
+			nv_onattr(np,NV_RDONLY|NV_MINIMAL|NV_NOFREE|NV_INTEGER);
+			nv_setsize(np,10);
+			np->nvalue.ip = &sh.stats[shtab_stats[i].sh_number];
+			break;
+		}
 	}
 	sp->hdr.dsize = sizeof(struct Stats) + extrasize;
 	sp->hdr.disc = &stat_disc;
+	nv_setvtree(SH_STATS);
+	/* on top of the tree discipline so that a reset does not unset the nodes */
 	nv_stack(SH_STATS,&sp->hdr);
 	sp->hdr.nofree = 1;
-	nv_setvtree(SH_STATS);
 }
 #endif /* SHOPT_STATS */
 
@@ -1861,6 +2083,8 @@ static Init_t *nv_init(void)
 	ip->SH_MATCH_init.hdr.nofree = 1;
 	ip->SH_MATH_init.disc = &SH_MATH_disc;
 	ip->SH_MATH_init.nofree = 1;
+	ip->SH_READAHEAD_init.disc = &READAHEAD_disc;
+	ip->SH_READAHEAD_init.nofree = 1;
 	ip->SH_VERSION_init.disc = &SH_VERSION_disc;
 	ip->SH_VERSION_init.nofree = 1;
 	ip->LINENO_init.disc = &LINENO_disc;
@@ -1906,6 +2130,7 @@ static Init_t *nv_init(void)
 	SH_MATCHNOD->nvfun =  &ip->SH_MATCH_init.hdr;
 	nv_putsub(SH_MATCHNOD,NULL,10);
 	nv_stack(SH_MATHNOD, &ip->SH_MATH_init);
+	nv_stack(SH_READAHEADNOD, &ip->SH_READAHEAD_init);
 	nv_stack(SH_VERSIONNOD, &ip->SH_VERSION_init);
 	nv_stack(LCTYPENOD, &ip->LC_TYPE_init);
 	nv_stack(LCALLNOD, &ip->LC_ALL_init);
@@ -1584,6 +1584,7 @@ static int io_heredoc(struct ionod *iop, const char *name, int traceon)
 		errormsg(SH_DICT,ERROR_system(1),e_tmpcreate);
 		UNREACHABLE();
 	}
+	sh_stats(STAT_TMPFILES);
 	if(iop->iofile&IOSTRG)
 	{
 		if(traceon)
@@ -1219,6 +1219,7 @@ int job_post(pid_t pid, pid_t join)
 	if(!sh.outpipe || sh.cpid==pid)
 		pw->p_flag = P_EXITSAVE;
 	pw->p_exitmin = sh.xargexit;
+	sh.xargexit = 0;
 	pw->p_exit = 0;
 	if(sh_isstate(SH_MONITOR))
 	{
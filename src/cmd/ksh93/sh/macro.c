@@ -905,7 +905,7 @@ static void mac_substitute(Mac_t *mp, char *cp,char *str,int subexp[],int subsiz
 {
 	int	c,n;
 	char	*first=fcseek(0);
-	char	*ptr;
+	char	*ptr, buff[64];
 	Mac_t	savemac;
 	n = stktell(sh.stk);
 	savemac = *mp;
@@ -915,7 +915,10 @@ static void mac_substitute(Mac_t *mp, char *cp,char *str,int subexp[],int subsiz
 	fcsopen(cp);
 	copyto(mp,0,0);
 	sfputc(sh.stk,0);
-	ptr = cp = sh_strdup(stkptr(sh.stk,n));
+	if((c = stktell(sh.stk)-n) <= sizeof(buff))
+		ptr = cp = memcpy(buff,stkptr(sh.stk,n),c);
+	else
+		ptr = cp = sh_strdup(stkptr(sh.stk,n));
 	stkseek(sh.stk,n);
 	*mp = savemac;
 	fcsopen(first);
@@ -948,7 +951,8 @@ static void mac_substitute(Mac_t *mp, char *cp,char *str,int subexp[],int subsiz
 	}
 	if(n=cp-first-1)
 		mac_copy(mp,first,n);
-	free(ptr);
+	if(ptr!=buff)
+		free(ptr);
 }
 
 #if  SHOPT_FILESCAN
@@ -1152,7 +1156,8 @@ static int varsub(Mac_t *mp)
 	Namarr_t	*ap=0;
 	int		dolmax=0, vsize= -1, offset= -1, nulflg, replen=0, bysub=0;
 	char		idbuff[3], *id = idbuff, *pattern=0, *repstr=0, *arrmax=0;
-	char		*idx = 0;
+	char		*idx = 0, patbuf[64];
+	size_t		patlen;
 	int		var=1,addsub=0,oldpat=mp->pattern,idnum=0,flag=0,d;
 	Stk_t		*stkp = sh.stk;
 	mp->wasexpan = 1;
@@ -1875,7 +1880,11 @@ retry1:
 			else
 				type = 0;
 		}
-		pattern = sh_strdup(argp);
+		/* the pattern is usually short; avoid the heap then */
+		if((patlen = strlen(argp)) < sizeof(patbuf))
+			pattern = memcpy(patbuf,argp,patlen+1);
+		else
+			pattern = sh_strdup(argp);
 		if((type=='/' || c=='/') && (repstr = mac_getstring(pattern)))
 			replen = strlen(repstr);
 		if(v || c=='/' && offset>=0)
@@ -2120,7 +2129,7 @@ retry2:
 		errormsg(SH_DICT,ERROR_exit(1),e_notset,id);
 		UNREACHABLE();
 	}
-	if(pattern)
+	if(pattern && pattern!=patbuf)
 		free(pattern);
 	if(idx)
 		free(idx);
@@ -1331,7 +1331,7 @@ void nv_delete(Namval_t* np, Dt_t *root, int flags)
 					nv_associative(np,0,NV_AFREE);
 					free(np->nvfun);
 				}
-				free(np);
+				nv_freenode(np);
 			}
 		}
 	}
@@ -1456,7 +1456,8 @@ Namval_t *nv_open(const char *name, Dt_t *root, int flags)
 	np = nv_create(name, root, flags, &fun);
 	cp = fun.last;
 #if NVCACHE
-	if(np && nvcache.ok && cp[-1]!=']')
+	/* .sh.stats members are refreshed by their lookup, so are not cached */
+	if(np && nvcache.ok && cp[-1]!=']' && sh.last_table!=SH_STATS)
 	{
 		xp = &nvcache.entries[nvcache.index];
 		if(*cp)
@@ -1865,22 +1866,22 @@ void nv_putval(Namval_t *np, const char *string, int flags)
 					sfprintf(sh.strbuf,"%.*Lg",LDBL_DIG,*((Sfdouble_t*)sp));
 				else
 					sfprintf(sh.strbuf,"%.*g",DBL_DIG,*((double*)sp));
+				sp = sfstruse(sh.strbuf);
 			}
 			else if(flags&NV_UNSIGN)
 			{
 				if(flags&NV_LONG)
-					sfprintf(sh.strbuf,"%I*lu",sizeof(Sfulong_t),*((Sfulong_t*)sp));
+					sp = fmtint(*((Sfulong_t*)sp),1);
 				else
-					sfprintf(sh.strbuf,"%lu",(unsigned long)((flags&NV_SHORT)?*((uint16_t*)sp):*((uint32_t*)sp)));
+					sp = fmtint((flags&NV_SHORT)?*((uint16_t*)sp):*((uint32_t*)sp),1);
 			}
 			else
 			{
 				if(flags&NV_LONG)
-					sfprintf(sh.strbuf,"%I*ld",sizeof(Sflong_t),*((Sflong_t*)sp));
+					sp = fmtint(*((Sflong_t*)sp),0);
 				else
-					sfprintf(sh.strbuf,"%ld",(long)((flags&NV_SHORT)?*((int16_t*)sp):*((int32_t*)sp)));
+					sp = fmtint((flags&NV_SHORT)?*((int16_t*)sp):*((int32_t*)sp),0);
 			}
-			sp = sfstruse(sh.strbuf);
 		}
 		if(nv_isattr(np, NV_HOST|NV_INTEGER)==NV_HOST && sp)
 		{
@@ -655,7 +655,7 @@ static void putdisc(Namval_t* np, const char* val, int flag, Namfun_t* fp)
 					if(mp->nvfun && !nv_isattr(mp,NV_NOFREE))
 						free(mp->nvfun);
 					dtdelete(sh.bltin_tree,mp);
-					free(mp);
+					nv_freenode(mp);
 				}
 			}
 		}
@@ -812,15 +812,138 @@ Namfun_t *nv_hasdisc(Namval_t *np, const Namdisc_t *dp)
 	return NULL;
 }
 
+/*
+ * Nodes created by nv_search() are allocated from slab pools, one for each
+ * size class of a node plus its name, so that creating many variables (such
+ * as associative array elements) does not call malloc(3) for each of them.
+ * A freed node goes on the free list of its class for reuse; slabs are not
+ * returned. A slab starts with a header giving its class, and the slabs are
+ * kept sorted by address so that nv_freenode() can tell slab nodes apart
+ * from nodes allocated elsewhere, which it passes to free(3).
+ */
+#define SLAB_ALIGN	16
+#define SLAB_NODE	roundof(sizeof(Namval_t),SLAB_ALIGN)
+#define SLAB_SIZE	(16*1024)
+
+typedef struct Slab_s
+{
+	int		class;
+	char		data[1];	/* SLAB_ALIGN aligned */
+} Slab_t;
+#define SLAB_DATA	roundof(offsetof(Slab_t,data),SLAB_ALIGN)
+
+static struct
+{
+	void		*free[NV_NSLAB];	/* free lists, linked by first word */
+	char		*next[NV_NSLAB];	/* unused part of newest slab */
+	char		*end[NV_NSLAB];
+	Slab_t		**slabs;		/* sorted by address */
+	size_t		nslabs;
+	size_t		maxslabs;
+	Nvslab_t	stat[NV_NSLAB];
+} slab;
+
 static void *newnode(const char *name)
 {
-	int s;
-	Namval_t *np = sh_newof(0,Namval_t,1,s=strlen(name)+1);
+	size_t	s = strlen(name)+1, size = sizeof(Namval_t)+s;
+	int	c = (int)((roundof(size,SLAB_ALIGN)-SLAB_NODE)/SLAB_ALIGN);
+	Namval_t *np;
+	if(c >= NV_NSLAB)
+		np = sh_newof(0,Namval_t,1,s);
+	else
+	{
+		if(np = slab.free[c])
+			slab.free[c] = *(void**)np;
+		else
+		{
+			size = SLAB_NODE+c*SLAB_ALIGN;
+			if(slab.next[c]+size > slab.end[c])
+			{
+				Slab_t	*sp = (Slab_t*)sh_malloc(SLAB_SIZE);
+				size_t	lo = 0, hi = slab.nslabs, m;
+				sp->class = c;
+				if(slab.nslabs == slab.maxslabs)
+				{
+					slab.maxslabs = slab.maxslabs ? 2*slab.maxslabs : 64;
+					slab.slabs = (Slab_t**)sh_realloc(slab.slabs,slab.maxslabs*sizeof(Slab_t*));
+				}
+				while(lo < hi)
+				{
+					m = (lo+hi)/2;
+					if(slab.slabs[m] < sp)
+						lo = m+1;
+					else
+						hi = m;
+				}
+				memmove(&slab.slabs[lo+1],&slab.slabs[lo],(slab.nslabs-lo)*sizeof(Slab_t*));
+				slab.slabs[lo] = sp;
+				slab.nslabs++;
+				slab.next[c] = (char*)sp+SLAB_DATA;
+				slab.end[c] = (char*)sp+SLAB_SIZE;
+				slab.stat[c].size = size;
+				slab.stat[c].slabs++;
+			}
+			np = (Namval_t*)slab.next[c];
+			slab.next[c] += size;
+		}
+		memset(np,0,sizeof(Namval_t));
+		slab.stat[c].live++;
+	}
 	np->nvname = (char*)np+sizeof(Namval_t);
 	memcpy(np->nvname,name,s);
 	return np;
 }
 
+/*
+ * free a node, whether or not it was created by nv_search()
+ */
+void nv_freenode(Namval_t *np)
+{
+	size_t	lo = 0, hi = slab.nslabs, m;
+	Slab_t	*sp;
+	if(!np)
+		return;
+	/* find the last slab starting at or below np */
+	while(lo < hi)
+	{
+		m = (lo+hi)/2;
+		if((char*)slab.slabs[m] <= (char*)np)
+			lo = m+1;
+		else
+			hi = m;
+	}
+	if(lo && (char*)np < (char*)(sp = slab.slabs[lo-1])+SLAB_SIZE)
+	{
+		*(void**)np = slab.free[sp->class];
+		slab.free[sp->class] = np;
+		slab.stat[sp->class].live--;
+		return;
+	}
+	free(np);
+}
+
+/*
+ * return the number of bytes taken by node <np>, including its name if
+ * that was allocated with it by nv_search()
+ */
+size_t nv_nodesize(Namval_t *np)
+{
+	if(np->nvname != (char*)np+sizeof(Namval_t))
+		return sizeof(Namval_t);
+	return roundof(sizeof(Namval_t)+strlen(np->nvname)+1,SLAB_ALIGN);
+}
+
+/*
+ * return the statistics of the NV_NSLAB node slab pools
+ */
+const Nvslab_t *nv_slabstat(void)
+{
+	int	c;
+	for(c=0; c < NV_NSLAB; c++)
+		slab.stat[c].size = SLAB_NODE+c*SLAB_ALIGN;
+	return slab.stat;
+}
+
 /*
  * clone a numeric value
  */
@@ -1292,7 +1415,7 @@ static void put_table(Namval_t* np, const char* val, int flags, Namfun_t* fp)
 		_nv_unset(mp,flags);
 		nq = (Namval_t*)dtnext(root,mp);
 		dtdelete(root,mp);
-		free(mp);
+		nv_freenode(mp);
 	}
 	if(sh.last_root==root)
 		sh.last_root = NULL;
@@ -78,6 +78,7 @@ static int ondefpath(const char *name)
 static pid_t _spawnveg(const char *path, char* const argv[], char* const envp[], pid_t pgid)
 {
 	pid_t pid;
+	Sfulong_t start = sh_statstime();
 	while(1)
 	{
 		sh_stats(STAT_SPAWN);
@@ -85,6 +86,11 @@ static pid_t _spawnveg(const char *path, char* const argv[], char* const envp[],
 		if(pid>=0 || errno!=EAGAIN)
 			break;
 	}
+	if(pid>0)
+	{
+		sh_statshist(spawnhist,start);
+		sh_profcount(PROF_SPAWN);
+	}
 	return pid;
 }
 
@@ -103,15 +109,18 @@ static unsigned arg_extra = _arg_extrabytes;
  * used with command -x to run the command in multiple passes
  * spawn is non-zero when invoked via spawn
  * the exitval is set to the maximum for each execution
+ * with command -x -P, up to sh.xargjobs passes run concurrently and
+ * the arguments are divided into at least that many balanced passes
  */
 static pid_t command_xargs(const char *path, char *argv[],char *const envp[], int spawn)
 {
 	char *cp, **av, **xv;
 	char **avlast= &argv[sh.xargmax], **saveargs=0;
 	char *const *ev;
-	ssize_t size, left;
+	ssize_t size, left, limit, z;
 	int nlast=1,n,exitval=0;
-	pid_t pid;
+	int jobs = sh.xargjobs > 1 ? sh.xargjobs : 1, nrun = 0, npass = 0;
+	pid_t pid, *running = 0;
 	if(sh.xargmin < 0)
 		abort();
 	/* get env/args buffer size (may change dynamically on Linux) */
@@ -135,17 +144,47 @@ static pid_t command_xargs(const char *path, char *argv[],char *const envp[], in
 		return -2;
 	}
 	av =  &argv[sh.xargmin];
+	if(jobs > 1)
+	{
+		/* divide the arguments evenly over at least as many passes as there are jobs */
+		for(z=0, xv=av; xv<avlast; xv++)
+			z += strlen(*xv) + 1 + arg_extra;
+		npass = (z + size - 1) / size;
+		if(npass < jobs)
+			npass = jobs;
+		running = (pid_t*)sh_malloc(jobs*sizeof(pid_t));
+	}
 	if(!spawn)
 		job_clear();
 	sh.exitval = 0;
 	while(av<avlast)
 	{
-		/* for each argument, account for terminating zero and possible extra bytes */
-		for(xv=av,left=size; left>0 && av<avlast;)
-			left -= strlen(*av++) + 1 + arg_extra;
-		/* leave at least two for last */
-		if(left<0 && (avlast-av)<2)
-			av--;
+		if(jobs > 1)
+		{
+			/* take at least one argument, then up to an even share of what is left */
+			limit = npass > 1 ? (z + npass - 1) / npass : z;
+			if(limit > size)
+				limit = size;
+			if(npass > 1)
+				npass--;
+			for(xv=av,left=limit; av<avlast; av++)
+			{
+				ssize_t len = strlen(*av) + 1 + arg_extra;
+				if(av>xv && len>left)
+					break;
+				left -= len;
+				z -= len;
+			}
+		}
+		else
+		{
+			/* for each argument, account for terminating zero and possible extra bytes */
+			for(xv=av,left=size; left>0 && av<avlast;)
+				left -= strlen(*av++) + 1 + arg_extra;
+			/* leave at least two for last */
+			if(left<0 && (avlast-av)<2)
+				av--;
+		}
 		if(xv==&argv[sh.xargmin])
 		{
 			n = nlast*sizeof(char*);
@@ -161,7 +200,23 @@ static pid_t command_xargs(const char *path, char *argv[],char *const envp[], in
 				argv[n++] = cp;
 			argv[n] = 0;
 		}
-		if(saveargs || av<avlast || (exitval && !spawn))
+		if(running && spawn && !saveargs && av>=avlast)
+		{
+			/* last pass: the caller waits for it, after the others are collected */
+			if((pid=_spawnveg(path,argv,envp,spawn>>1)) >= 0)
+			{
+				while(nrun)
+				{
+					job_wait(running[--nrun]);
+					if(sh.exitval>exitval)
+						exitval = sh.exitval;
+				}
+				sh.xargexit = exitval;
+			}
+			free(running);
+			return pid;
+		}
+		if(saveargs || av<avlast || (exitval && !spawn) || running)
 		{
 			if((pid=_spawnveg(path,argv,envp,0)) < 0)
 			{
@@ -170,12 +225,28 @@ static pid_t command_xargs(const char *path, char *argv[],char *const envp[], in
 					memcpy(av,saveargs,n);
 					free(saveargs);
 				}
+				free(running);
 				return -1;
 			}
 			job_post(pid,0);
-			job_wait(pid);
-			if(sh.exitval>exitval)
-				exitval = sh.exitval;
+			if(running)
+			{
+				/* the passes are of similar size, so wait for the oldest when all jobs are busy */
+				running[nrun++] = pid;
+				if(nrun==jobs || av>=avlast)
+				{
+					pid = running[0];
+					memmove(running,running+1,--nrun*sizeof(pid_t));
+				}
+				else
+					pid = 0;
+			}
+			if(pid)
+			{
+				job_wait(pid);
+				if(sh.exitval>exitval)
+					exitval = sh.exitval;
+			}
 			if(saveargs)
 			{
 				memcpy(av,saveargs,n);
@@ -191,6 +262,13 @@ static pid_t command_xargs(const char *path, char *argv[],char *const envp[], in
 		else
 			return execve(path,argv,envp);
 	}
+	while(nrun)
+	{
+		job_wait(running[--nrun]);
+		if(sh.exitval>exitval)
+			exitval = sh.exitval;
+	}
+	free(running);
 	if(!spawn)
 		exit(exitval);
 	return -1;
@@ -811,6 +889,8 @@ Pathcomp_t *path_absolute(const char *name, Pathcomp_t *pp, int flag)
 		sh.bltin_dir = 0;
 		sh_stats(STAT_PATHS);
 		f = canexecute(stkptr(sh.stk,PATH_OFFSET),isfun);
+		if(f<0)
+			sh_stats(STAT_PATHMISS);
 		if(isfun && f>=0 && (cp = strrchr(name,'.')))
 		{
 			*cp = 0;
@@ -967,6 +1047,7 @@ noreturn void path_exec(const char *arg0,char *argv[],struct argnod *local)
 	else
 		pp=path_get(arg0);
 	sh.path_err= ENOENT;
+	sh_profdone();
 	sfsync(NULL);
 	sh_timerdel(NULL);
 	/* find first path that has a library component */
@@ -0,0 +1,372 @@
+/***********************************************************************
+*                                                                      *
+*               This software is part of the ast package               *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
+*                      and is licensed under the                       *
+*                 Eclipse Public License, Version 2.0                  *
+*                                                                      *
+*                A copy of the License is available at                 *
+*      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      *
+*         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         *
+*                                                                      *
+*                  Martijn Dekker <martijn@inlv.org>                   *
+*                                                                      *
+***********************************************************************/
+/*
+ * Execution profiler for 'set -o profile'
+ *
+ * Every simple command, [[ ]], (( )), for and case records its line; every
+ * function call and dot script pushes a frame. Between two such events, the
+ * elapsed wall clock and CPU time (including that of reaped children) and
+ * the processes started are charged to the current line of the current
+ * call stack. Each distinct stack is a node in a hash table keyed by its
+ * parent node, frame name, file and line, so an event costs one lookup.
+ *
+ * On exit (or before the shell is replaced by exec) the nodes are written
+ * in the "collapsed stack" format read by flame graph tools: one line per
+ * stack and metric, frames separated by semicolons, each frame written as
+ * "name (file:line)", then the value. The first frame names the metric:
+ * wall_us, cpu_us, forks or spawns. The report is appended to the file
+ * named by $KSH_PROFILE, or written to standard error if that is unset.
+ */
+
+#include	"shopt.h"
+#include	"defs.h"
+#include	"io.h"
+#include	"shnodes.h"
+#include	<cdt.h>
+#include	"FEATURE/time"
+
+#if SHOPT_PROFILER
+
+#if _lib_getrusage && !defined(RUSAGE_SELF)
+#   include <sys/resource.h>
+#endif
+
+typedef struct Profnode_s Profnode_t;
+
+typedef struct Profkey_s
+{
+	Profnode_t	*parent;	/* node of the calling line */
+	const char	*name;		/* function or script name (interned) */
+	const char	*file;		/* file name (interned) */
+	int		line;
+} Profkey_t;
+
+struct Profnode_s
+{
+	Dtlink_t	link;
+	Profkey_t	key;
+	Sfulong_t	wall;		/* nanoseconds */
+	Sfulong_t	cpu;		/* microseconds */
+	Sfulong_t	count[2];	/* PROF_FORK, PROF_SPAWN */
+};
+
+typedef struct Profname_s
+{
+	Dtlink_t	link;
+	char		name[1];
+} Profname_t;
+
+static void freeobj(Dt_t *dt, void *obj, Dtdisc_t *disc)
+{
+	NOT_USED(dt);
+	NOT_USED(disc);
+	free(obj);
+}
+
+static Dtdisc_t	_Profdisc =
+{
+	offsetof(Profnode_t,key), offsetof(Profkey_t,line)+sizeof(int), offsetof(Profnode_t,link), 0, freeobj
+};
+static Dtdisc_t	_Namedisc =
+{
+	offsetof(Profname_t,name), 0, offsetof(Profname_t,link), 0, freeobj
+};
+
+static struct
+{
+	Dt_t		*nodes;
+	Dt_t		*names;
+	Profnode_t	*cur;		/* current line of current stack */
+	int		depth;		/* frames pushed since profiling started */
+	pid_t		pid;		/* only this process reports */
+	char		children;	/* processes were started */
+	Sfulong_t	wall;		/* time of the last event */
+	Sfulong_t	cpu;
+} prof;
+
+static Sfulong_t getcpu(void)
+{
+#if _lib_getrusage
+	struct rusage	ru;
+	Sfulong_t	t;
+	getrusage(RUSAGE_SELF,&ru);
+	t = (Sfulong_t)(ru.ru_utime.tv_sec+ru.ru_stime.tv_sec)*1000000 + ru.ru_utime.tv_usec + ru.ru_stime.tv_usec;
+	if(prof.children)
+	{
+		getrusage(RUSAGE_CHILDREN,&ru);
+		t += (Sfulong_t)(ru.ru_utime.tv_sec+ru.ru_stime.tv_sec)*1000000 + ru.ru_utime.tv_usec + ru.ru_stime.tv_usec;
+	}
+	return t;
+#else
+	struct tms	tp;
+	times(&tp);
+	return (Sfulong_t)(tp.tms_utime+tp.tms_stime+tp.tms_cutime+tp.tms_cstime)*1000000/sh.lim.clk_tck;
+#endif
+}
+
+static const char *intern(const char *s)
+{
+	Profname_t	*np;
+	if(!s)
+		s = "";
+	if(!(np = dtmatch(prof.names,(void*)s)))
+	{
+		np = sh_malloc(sizeof(Profname_t)+strlen(s));
+		strcpy(np->name,s);
+		dtinsert(prof.names,np);
+	}
+	return np->name;
+}
+
+static Profnode_t *node(Profnode_t *parent, const char *name, const char *file, int line)
+{
+	Profkey_t	key;
+	Profnode_t	*pp;
+	memset(&key,0,sizeof(key));
+	key.parent = parent;
+	key.name = name;
+	key.file = file;
+	key.line = line;
+	if(!(pp = dtmatch(prof.nodes,&key)))
+	{
+		pp = sh_newof(0,Profnode_t,1,0);
+		pp->key = key;
+		dtinsert(prof.nodes,pp);
+	}
+	return pp;
+}
+
+/*
+ * charge the time since the last event to the current node
+ * set up the tables and the root frame on first use
+ */
+static void charge(void)
+{
+	Sfulong_t	wall = sh_monotime(), cpu = getcpu();
+	if(!prof.nodes)
+	{
+		const char *file = sh.st.filename ? sh.st.filename : sh_isoption(SH_CFLAG) ? "-c" : sh.shname;
+		prof.nodes = dtopen(&_Profdisc,Dtset);
+		prof.names = dtopen(&_Namedisc,Dtset);
+		prof.cur = node(NULL,intern(sh.fn_depth && sh.st.funname ? sh.st.funname : "main"),intern(file),error_info.line);
+		prof.depth = 0;
+	}
+	else
+	{
+		prof.cur->wall += wall - prof.wall;
+		prof.cur->cpu += cpu - prof.cpu;
+	}
+	prof.wall = wall;
+	prof.cpu = cpu;
+}
+
+/*
+ * called when 'set -o profile' is turned on; the process that first does
+ * this is the one that is profiled, not the subshells it forks later
+ */
+void sh_profstart(void)
+{
+	if(!prof.pid)
+		prof.pid = sh.current_pid;
+	else if(prof.nodes && prof.pid==sh.current_pid)
+	{
+		/* forget the time it was off */
+		prof.wall = sh_monotime();
+		prof.cpu = getcpu();
+	}
+}
+
+/*
+ * a command on <line> is about to be run
+ */
+void _sh_profline(int line)
+{
+	Profnode_t	*pp;
+	if(prof.pid!=sh.current_pid)
+		return;
+	charge();
+	pp = prof.cur;
+	if(pp->key.line != line)
+		prof.cur = node(pp->key.parent,pp->key.name,pp->key.file,line);
+}
+
+/*
+ * a subshell is about to be forked for <t>; charge the fork to the line
+ * of its first command, as the forkline recorded by the parser is the
+ * line of the token that ended the subshell
+ */
+void _sh_proffork(const Shnode_t *t)
+{
+	while(t)
+	{
+		switch(t->tre.tretyp&COMMSK)
+		{
+		    case TCOM:
+			_sh_profline(t->com.comline-sh.st.firstline);
+			return;
+		    case TFOR:
+			_sh_profline(t->for_.forline-sh.st.firstline);
+			return;
+		    case TSW:
+			_sh_profline(t->sw.swline-sh.st.firstline);
+			return;
+		    case TTST:
+			_sh_profline(t->tst.tstline-sh.st.firstline);
+			return;
+		    case TARITH:
+			_sh_profline(t->ar.arline-sh.st.firstline);
+			return;
+		    case TFORK:
+		    case TSETIO:
+			t = t->fork.forktre;
+			break;
+		    case TPAR:
+		    case TTIME:
+			t = t->par.partre;
+			break;
+		    case TFIL:
+		    case TLST:
+		    case TAND:
+		    case TORF:
+			t = t->lst.lstlef;
+			break;
+		    case TIF:
+			t = t->if_.iftre;
+			break;
+		    case TWH:
+			t = t->wh.whtre;
+			break;
+		    default:
+			return;
+		}
+	}
+}
+
+/*
+ * a function or dot script <name> starting at <line> of <file> is being entered
+ */
+void _sh_profcall(const char *name, const char *file, int line)
+{
+	if(prof.pid!=sh.current_pid)
+		return;
+	charge();
+	if(!file)
+		file = prof.cur->key.file;
+	prof.cur = node(prof.cur,intern(name),intern(file),line);
+	prof.depth++;
+}
+
+/*
+ * the function or dot script entered last is returning
+ */
+void _sh_profreturn(void)
+{
+	if(!prof.nodes || prof.pid!=sh.current_pid)
+		return;
+	charge();
+	if(prof.depth > 0)
+	{
+		prof.depth--;
+		prof.cur = prof.cur->key.parent;
+	}
+}
+
+/*
+ * a process of the given kind was started
+ */
+void _sh_profcount(int kind)
+{
+	if(prof.pid!=sh.current_pid)
+		return;
+	if(!prof.nodes)
+		charge();
+	prof.cur->count[kind]++;
+	prof.children = 1;
+}
+
+/*
+ * write the frames from the root down to <pp>
+ */
+static void putstack(Sfio_t *out, Profnode_t *pp)
+{
+	if(pp->key.parent)
+		putstack(out,pp->key.parent);
+	sfprintf(out,";%s (%s:%d)",pp->key.name,pp->key.file,pp->key.line);
+}
+
+static void putmetric(Sfio_t *out, const char *metric, Profnode_t *pp, Sfulong_t value)
+{
+	if(value)
+	{
+		sfputr(out,metric,-1);
+		putstack(out,pp);
+		sfprintf(out," %llu\n",value);
+	}
+}
+
+/*
+ * write the profile and start afresh; called on exit and before exec
+ */
+void sh_profdone(void)
+{
+	Profnode_t	*pp;
+	Namval_t	*np;
+	Sfio_t		*out;
+	char		*file, *s;
+	ssize_t		n;
+	int		fd;
+	if(!prof.nodes || prof.pid!=sh.current_pid)
+		return;
+	charge();
+	if(!(out = sfstropen()))
+		return;
+	for(pp = dtfirst(prof.nodes); pp; pp = dtnext(prof.nodes,pp))
+	{
+		putmetric(out,"wall_us",pp,pp->wall/1000);
+		putmetric(out,"cpu_us",pp,pp->cpu);
+		putmetric(out,"forks",pp,pp->count[PROF_FORK]);
+		putmetric(out,"spawns",pp,pp->count[PROF_SPAWN]);
+	}
+	n = sfstrtell(out);
+	s = sfstruse(out);
+	np = nv_search("KSH_PROFILE",sh.var_tree,0);
+	if(np && (file = nv_getval(np)) && *file)
+	{
+		/* one write(2) so that concurrent shells do not interleave lines */
+		if((fd = sh_open(file,O_WRONLY|O_APPEND|O_CREAT|O_CLOEXEC,S_IRUSR|S_IRGRP|S_IROTH|S_IWUSR|S_IWGRP|S_IWOTH)) >= 0)
+		{
+			if(write(fd,s,n) != n)
+				errormsg(SH_DICT,ERROR_warn(0),"%s: cannot write profile",file);
+			sh_close(fd);
+		}
+		else
+			errormsg(SH_DICT,ERROR_warn(0),e_create,file);
+	}
+	else
+	{
+		sfwrite(sfstderr,s,n);
+		sfsync(sfstderr);
+	}
+	sfstrclose(out);
+	dtclose(prof.nodes);
+	dtclose(prof.names);
+	prof.nodes = prof.names = NULL;
+}
+
+#else
+
+NoN(profiler)
+
+#endif /* SHOPT_PROFILER */
@@ -92,6 +92,7 @@ static struct subshell
 	int		rand_last;          /* last random number from $RANDOM in parent shell */
 	int		rand_state;         /* 0 means sp->rand_seed hasn't been set, 1 is the opposite */
 	uint32_t	srand_upper_bound;  /* parent shell's upper bound for $SRANDOM */
+	ssize_t		readahead;          /* parent shell's ${.sh.readahead} */
 #if _lib_fchdir
 	int		pwdfd;	/* file descriptor for PWD */
 	char		pwdclose;
@@ -132,6 +133,7 @@ void	sh_subtmpfile(void)
 			errormsg(SH_DICT,ERROR_SYSTEM|ERROR_PANIC,"could not create temp file");
 			UNREACHABLE();
 		}
+		sh_stats(STAT_TMPFILES);
 		sh.fdstatus[fd] = IOREAD|IOWRITE;
 		sfsync(sfstdout);
 		if(fd==1)
@@ -174,6 +176,8 @@ void sh_subfork(void)
 	{
 		sh.curenv = curenv;
 		/* this is the parent part of the fork */
+		if(comsub)
+			sh_stats(STAT_COMSUBFORK);
 		if(sp->subpid==0)
 			sp->subpid = pid;
 		if(trap)
@@ -218,7 +222,7 @@ int nv_subsaved(Namval_t *np, int flags)
 						lpprev->next = lp->next;
 					else
 						sp->svar = lp->next;
-					free(np);
+					nv_freenode(np);
 					free(lp);
 				}
 				return 1;
@@ -588,6 +592,8 @@ Sfio_t *sh_subshell(Shnode_t *t, volatile int flags, int comsub)
 			sh.st.trap[SH_DEBUGTRAP] = save_debugtrap;
 		/* save upper bound for $SRANDOM */
 		sp->srand_upper_bound = sh.srand_upper_bound;
+		/* save sfio read buffer cap for ${.sh.readahead} */
+		sp->readahead = sfmaxbuf(0,0);
 	}
 	jmpval = sigsetjmp(checkpoint.buff,0);
 	if(jmpval==0)
@@ -861,6 +867,8 @@ Sfio_t *sh_subshell(Shnode_t *t, volatile int flags, int comsub)
 		}
 		/* restore $SRANDOM upper bound */
 		sh.srand_upper_bound = sp->srand_upper_bound;
+		/* restore ${.sh.readahead} */
+		sfmaxbuf(sp->readahead,1);
 		/* Real subshells have their exit status truncated to 8 bits by the kernel.
 		 * Since virtual subshells should be indistinguishable, do the same here. */
 		sh.exitval &= SH_EXITMASK;
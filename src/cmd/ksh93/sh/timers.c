@@ -42,6 +42,24 @@ typedef struct _timer
 static Timer_t *tptop, *tpmin, *tpfree;
 static char time_state;
 
+/*
+ * nanoseconds on a monotonic clock, for measuring durations
+ */
+Sfulong_t sh_monotime(void)
+{
+#ifdef CLOCK_MONOTONIC
+	struct timespec	ts;
+	clock_gettime(CLOCK_MONOTONIC,&ts);
+	return (Sfulong_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+#elif defined(timeofday)
+	struct timeval	tv;
+	timeofday(&tv);
+	return (Sfulong_t)tv.tv_sec*1000000000 + (Sfulong_t)tv.tv_usec*1000;
+#else
+	return (Sfulong_t)time(NULL)*1000000000;
+#endif
+}
+
 static double getnow(void)
 {
 	double now;
@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1982-2012 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2024 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -74,6 +74,21 @@ struct funenv
 	Namval_t	**nref;
 };
 
+/* a simple command traced by 'set -o jsontrace' */
+struct jtrace
+{
+	char		**argv;		/* NULL if not traced */
+	char		*func;		/* function it is run from */
+	Sfulong_t	start;		/* monotonic clock, nanoseconds */
+	pid_t		pid;
+	int		line;
+	char		async;		/* not waited for */
+};
+
+static Sfio_t	*jtrace_out;
+static void	jtrace_begin(struct jtrace*, char*[]);
+static void	jtrace_end(struct jtrace*);
+
 /* ========	command execution	======== */
 
 #if !SHOPT_DEVFD
@@ -848,6 +863,10 @@ static int check_exec_optimization(int type, int execflg, int execflg2, struct i
 	|| sh.subshell
 	|| ((struct checkpt*)sh.jmplist)->mode==SH_JMPEVAL
 	|| sh_isstate(SH_XARG)
+	|| sh_isoption(SH_JSONTRACE)
+#if SHOPT_PROFILER
+	|| sh_isoption(SH_PROFILING)
+#endif
 	|| (pipejob && (sh_isstate(SH_MONITOR) || sh_isoption(SH_PIPEFAIL) || sh_isstate(SH_TIMING))))
 	{
 		return 0;
@@ -876,6 +895,9 @@ int sh_exec(const Shnode_t *t, int flags)
 	sh.lastsig = 0;
 	sh.chldexitsig = 0;
 	type = t->tre.tretyp;
+	/* anything but an operator inside [[ ... ]] may change the files whose stat(2) results test_unop() cached */
+	if(sh.statcache && !((type&TTEST) && ((type&COMMSK)==TTST || (type&COMMSK)==TAND || (type&COMMSK)==TORF)))
+		test_statcache(0);
 	mainloop = (flags&sh_state(SH_INTERACTIVE));
 	if(mainloop)
 	{
@@ -898,6 +920,7 @@ int sh_exec(const Shnode_t *t, int flags)
 		&& !t->com.comset					/* no variable assignments list */
 		&& !t->com.comio					/* no I/O redirections */
 		&& !sh_isoption(SH_XTRACE)
+		&& !sh_isoption(SH_JSONTRACE)
 		&& !sh.st.trap[SH_DEBUGTRAP])
 		{
 			/* Execute optimized basic versions of the builtins */
@@ -923,10 +946,12 @@ int sh_exec(const Shnode_t *t, int flags)
 		char		*cp=0, **com=0, *comn;
 		int		argn;
 		int 		skipexitset = 0;
+		struct jtrace	jt;
 		volatile int	was_interactive = 0;
 		volatile int	was_errexit = sh_isstate(SH_ERREXIT);
 		volatile int	was_monitor = sh_isstate(SH_MONITOR);
 		volatile int	echeck = 0;
+		jt.argv = NULL;
 		sh_offstate(SH_DEFPATH);
 		if(!(flags & sh_state(SH_ERREXIT)))
 			sh_offstate(SH_ERREXIT);
@@ -946,6 +971,7 @@ int sh_exec(const Shnode_t *t, int flags)
 			type &= (COMMSK|COMSCAN);
 			sh_stats(STAT_SCMDS);
 			error_info.line = t->com.comline-sh.st.firstline;
+			sh_profline();
 			com = sh_argbuild(&argn,&(t->com),flags & ARG_OPTIMIZE);
 			echeck = 1;
 			if(t->tre.tretyp&COMSCAN)
@@ -969,6 +995,7 @@ int sh_exec(const Shnode_t *t, int flags)
 #endif /* SHOPT_NAMESPACE */
 			com0 = com[0];
 			sh_offstate(SH_XARG);
+			sh.xargjobs = 0;
 			while(np==SYSCOMMAND || !np && com0 && nv_search(com0,sh.fun_tree,0)==SYSCOMMAND)
 			{
 				int n = b_command(0,com,&sh.bltindata);
@@ -1133,6 +1160,8 @@ int sh_exec(const Shnode_t *t, int flags)
 				}
 				else if((np!=SYSSET) && sh_isoption(SH_XTRACE))
 					sh_trace(com-command,tflags);
+				if(argn && sh_isoption(SH_JSONTRACE))
+					jtrace_begin(&jt,com-command);
 				if(trap=sh.st.trap[SH_DEBUGTRAP])
 				{
 					int n = sh_debug(trap,NULL,NULL,com,ARG_RAW);
@@ -1269,7 +1298,23 @@ int sh_exec(const Shnode_t *t, int flags)
 						if(sh.subshell && nv_isattr(np,BLT_NOSFIO))
 							sh_subtmpfile();
 						if(argn)
+						{
+#if SHOPT_STATS
+							int		bltin = -1;
+							Sfulong_t	bltstart = 0;
+							if(np >= sh.bltin_cmds && np < sh.bltin_cmds+sh_xstats.nbltins)
+							{
+								bltin = np - sh.bltin_cmds;
+								sh_xstats.bltcalls[bltin]++;
+								bltstart = sh_monotime();
+							}
+#endif /* SHOPT_STATS */
 							sh.exitval = (*sh.bltinfun)(argn,com,bp);
+#if SHOPT_STATS
+							if(bltin >= 0)
+								sh_xstats.bltns[bltin] += sh_monotime() - bltstart;
+#endif /* SHOPT_STATS */
+						}
 						if(error_info.flags&ERROR_INTERACTIVE)
 							tty_check(ERRIO);
 						((Shnode_t*)t)->com.comstate = sh.bltindata.data;
@@ -1335,7 +1380,10 @@ int sh_exec(const Shnode_t *t, int flags)
 					bp->data = (void*)save_data;
 					sh.redir0 = 0;
 					if(jmpval)
+					{
+						jtrace_end(&jt);
 						siglongjmp(*sh.jmplist,jmpval);
+					}
 					if(sh.exitval >=0)
 						goto setexit;
 					/*
@@ -1452,7 +1500,10 @@ int sh_exec(const Shnode_t *t, int flags)
 						stkclose(sp);
 					}
 					if(jmpval > SH_JMPFUN || (io && jmpval > SH_JMPIO))
+					{
+						jtrace_end(&jt);
 						siglongjmp(*sh.jmplist,jmpval);
+					}
 					goto setexit;
 				}
 				/* not a built-in or function: external command, fall through to TFORK */
@@ -1485,6 +1536,8 @@ int sh_exec(const Shnode_t *t, int flags)
 				parent = 0;
 			else
 			{
+				if((type&COMMSK)!=TCOM)
+					sh_proffork(t);
 #if SHOPT_BGX
 				int maxjob;
 				if(((type&(FAMP|FINT)) == (FAMP|FINT)) && (maxjob=nv_getnum(JOBMAXNOD))>0)
@@ -1559,6 +1612,8 @@ int sh_exec(const Shnode_t *t, int flags)
 					if(!sh_isstate(SH_MONITOR))
 						sigrelease(SIGINT);
 				}
+				if((type&(FCOOP|FAMP|FPOU)) || sh.pipepid==parent)
+					jt.async = 1;
 				/* print job number */
 				if(type&FAMP && (sh_isstate(SH_PROFILE) || sh_isstate(SH_INTERACTIVE)))
 					sfprintf(sfstderr,"[%d]\t%d\n",jobid,parent);
@@ -1965,6 +2020,8 @@ int sh_exec(const Shnode_t *t, int flags)
 				skipexitset++;
 			if(sh_exec(t->lst.lstlef, flags & ARG_OPTIMIZE)==0)
 				sh_exec(t->lst.lstrit,flags);
+			if(sh.statcache && !(type&TTEST))
+				test_statcache(0);
 			break;
 
 		    /*
@@ -1975,6 +2032,8 @@ int sh_exec(const Shnode_t *t, int flags)
 				skipexitset++;
 			if(sh_exec(t->lst.lstlef, flags & ARG_OPTIMIZE)!=0)
 				sh_exec(t->lst.lstrit,flags);
+			if(sh.statcache && !(type&TTEST))
+				test_statcache(0);
 			break;
 
 		    /*
@@ -2003,6 +2062,7 @@ int sh_exec(const Shnode_t *t, int flags)
 				goto endfor;
 #endif /* SHOPT_OPTIMIZE */
 			error_info.line = t->for_.forline-sh.st.firstline;
+			sh_profline();
 			if(!(tp=t->for_.forlst))
 			{
 				args=sh.st.dolv+1;
@@ -2162,6 +2222,7 @@ int sh_exec(const Shnode_t *t, int flags)
 				&& !tt->com.comset			/* no variable assignments list */
 				&& !tt->com.comio			/* no I/O redirections */
 				&& !sh_isoption(SH_XTRACE)
+				&& !sh_isoption(SH_JSONTRACE)
 				&& !sh.st.trap[SH_DEBUGTRAP]);
 			sh.st.loopcnt++;
 			while(sh.st.breakcnt==0)
@@ -2226,6 +2287,7 @@ int sh_exec(const Shnode_t *t, int flags)
 			char *trap;
 			char *arg[4];
 			error_info.line = t->ar.arline-sh.st.firstline;
+			sh_profline();
 			arg[0] = "((";
 			if(!(t->ar.arexpr->argflag&ARG_RAW))
 				arg[1] = sh_macpat(t->ar.arexpr,(flags & ARG_OPTIMIZE)|ARG_ARITH);
@@ -2267,6 +2329,7 @@ int sh_exec(const Shnode_t *t, int flags)
 			const int eflag = flags & sh_state(SH_ERREXIT);
 			char *r = sh_macpat(t->sw.swarg, flags & ARG_OPTIMIZE);
 			error_info.line = t->sw.swline - sh.st.firstline;
+			sh_profline();
 			if(sh.st.trap[SH_DEBUGTRAP])
 			{
 				char *av[4];
@@ -2539,6 +2602,12 @@ int sh_exec(const Shnode_t *t, int flags)
 				if(slp->slptr)
 					stklink(slp->slptr);
 				np->nvmeta = slp;
+				if(slp->slptr)
+				{
+					Stkstat_t st;
+					stkstat(slp->slptr,&st,0);
+					np->nvalue.rp->treesize = st.size;
+				}
 				nv_funtree(np) = (int*)(t->funct.functtre);
 				np->nvalue.rp->lineno = t->funct.functline;
 				np->nvalue.rp->nspace = sh.namespace;
@@ -2582,6 +2651,7 @@ int sh_exec(const Shnode_t *t, int flags)
 			if(type&TTEST)
 				skipexitset++;
 			error_info.line = t->tst.tstline-sh.st.firstline;
+			sh_profline();
 			echeck = 1;
 			if((type&TPAREN)==TPAREN)
 			{
@@ -2621,6 +2691,7 @@ int sh_exec(const Shnode_t *t, int flags)
 						argv[4] = 0;
 						sh_debug(trap,NULL,NULL,argv,0);
 					}
+					test_statcache(1);
 					n = test_unop(n,left);
 				}
 				else if(type&TBINARY)
@@ -2641,6 +2712,7 @@ int sh_exec(const Shnode_t *t, int flags)
 						argv[5] = 0;
 						sh_debug(trap,NULL,NULL,argv,pattern);
 					}
+					test_statcache(1);
 					n = test_binop(n,left,right);
 					if(traceon)
 					{
@@ -2654,12 +2726,15 @@ int sh_exec(const Shnode_t *t, int flags)
 				if(traceon)
 					sfwrite(sfstderr,e_tstend,4);
 			}
+			if(!(t->tre.tretyp&TTEST))
+				test_statcache(0);
 			sh.exitval = ((!n)^negate); 
 			if(!skipexitset)
 				exitset();
 			break;
 		    }
 		}
+		jtrace_end(&jt);
 		if(sh.trapnote || (sh.exitval && sh_isstate(SH_ERREXIT)) && t && echeck)
 			sh_chktrap();
 		/* set $_ */
@@ -2791,6 +2866,160 @@ int sh_trace(char *argv[], int nl)
 	return 0;
 }
 
+/*
+ * open the stream for 'set -o jsontrace' on the file descriptor
+ * given by $KSH_TRACEFD, or on standard error
+ */
+void sh_jtraceopen(void)
+{
+	Namval_t	*np = nv_search("KSH_TRACEFD",sh.var_tree,0);
+	char		*cp, *last;
+	int		fd = 2;
+	if(np && (cp = nv_getval(np)) && *cp)
+	{
+		fd = (int)strtol(cp,&last,10);
+		if(*last || fd<0 || fcntl(fd,F_GETFD)<0)
+		{
+			errormsg(SH_DICT,ERROR_warn(0),"%s: invalid trace file descriptor",cp);
+			fd = 2;
+		}
+	}
+	if(jtrace_out)
+	{
+		if(sffileno(jtrace_out)==fd)
+			return;
+		/* do not close the file descriptor, it is not ours */
+		sfsync(jtrace_out);
+		sfsetfd(jtrace_out,-1);
+		sfclose(jtrace_out);
+	}
+	jtrace_out = sfnew(NULL,NULL,SFIO_UNBOUND,fd,SFIO_WRITE);
+}
+
+/*
+ * write out the buffered trace records; called when 'set -o jsontrace' is
+ * turned off and on exit (the buffer is also flushed by sfsync(NULL) before
+ * forking or spawning)
+ */
+void sh_jtracesync(void)
+{
+	if(jtrace_out)
+		sfsync(jtrace_out);
+}
+
+/*
+ * a simple command with arguments <argv> is about to be run
+ */
+static void jtrace_begin(struct jtrace *jp, char *argv[])
+{
+	jp->argv = argv;
+	jp->pid = sh.current_pid;
+	jp->line = error_info.line;
+	jp->func = nv_getval(SH_FUNNAMENOD);
+	jp->async = 0;
+	jp->start = sh_monotime();
+}
+
+/*
+ * return the length of the valid UTF-8 sequence at <cp>, or 0 if none
+ */
+static int jtrace_utf8(const unsigned char *cp)
+{
+	int	c = *cp, n, i;
+	if(c >= 0xc2 && c <= 0xdf)
+		n = 2;
+	else if(c >= 0xe0 && c <= 0xef)
+	{
+		/* reject overlong forms and UTF-16 surrogates */
+		if((c==0xe0 && cp[1] < 0xa0) || (c==0xed && cp[1] > 0x9f))
+			return 0;
+		n = 3;
+	}
+	else if(c >= 0xf0 && c <= 0xf4)
+	{
+		/* reject overlong forms and code points above U+10FFFF */
+		if((c==0xf0 && cp[1] < 0x90) || (c==0xf4 && cp[1] > 0x8f))
+			return 0;
+		n = 4;
+	}
+	else
+		return 0;
+	for(i=1; i < n; i++)
+		if((cp[i] & 0xc0) != 0x80)
+			return 0;
+	return n;
+}
+
+/*
+ * write <s> as a JSON string; bytes that are not part of valid UTF-8 are
+ * written as \u00XX escapes, so that the record is always valid JSON
+ */
+static void jtrace_string(Sfio_t *out, const char *s)
+{
+	const unsigned char	*cp = (const unsigned char*)s, *sp;
+	int			c, n;
+	sfputc(out,'"');
+	for(;;)
+	{
+		for(sp=cp; (c = *cp) >= 0x20 && c < 0x7f && c!='"' && c!='\\'; cp++);
+		if(cp > sp)
+			sfwrite(out,sp,cp-sp);
+		if(!c)
+			break;
+		if(c=='"' || c=='\\')
+		{
+			sfputc(out,'\\');
+			sfputc(out,c);
+		}
+		else if(c >= 0x80 && (n = jtrace_utf8(cp)))
+		{
+			sfwrite(out,cp,n);
+			cp += n;
+			continue;
+		}
+		else
+			sfprintf(out,"\\u%04x",c);
+		cp++;
+	}
+	sfputc(out,'"');
+}
+
+/*
+ * write the record for the simple command traced by jtrace_begin(); the
+ * command is not reported by subshells that were forked while it ran
+ */
+static void jtrace_end(struct jtrace *jp)
+{
+	Sfio_t	*out = jtrace_out;
+	char	**av;
+	if(!jp->argv)
+		return;
+	if(out && jp->pid==sh.current_pid)
+	{
+		Sfulong_t now = sh_monotime();
+		sfprintf(out,"{\"t\":%llu,\"dur\":%llu,\"pid\":%lld,\"sub\":%d,\"line\":%d,\"func\":",
+			jp->start,now-jp->start,(Sflong_t)jp->pid,sh.realsubshell,jp->line);
+		if(jp->func)
+			jtrace_string(out,jp->func);
+		else
+			sfputr(out,"null",-1);
+		sfputr(out,",\"argv\":[",-1);
+		for(av=jp->argv; *av; av++)
+		{
+			if(av > jp->argv)
+				sfputc(out,',');
+			jtrace_string(out,*av);
+		}
+		if(jp->async)
+			sfputr(out,"],\"status\":null}",'\n');
+		else
+			sfprintf(out,"],\"status\":%d}\n",sh.exitval);
+		if(!sh_isoption(SH_JSONTRACE))
+			sfsync(out);
+	}
+	jp->argv = NULL;
+}
+
 static void timed_out(void *handle)
 {
 	NOT_USED(handle);
@@ -2936,14 +3165,21 @@ pid_t sh_fork(int flags, int *jobid)
 {
 	pid_t parent;
 	int sig;
+	Sfulong_t start;
 	if(!sh.pathlist)
 		path_get(Empty);
 	sfsync(NULL);
 	sh.trapnote &= ~SH_SIGTERM;
 	job_fork(-1);
 	sh.savesig = -1;
+	start = sh_statstime();
 	while(_sh_fork(parent=fork(),flags,jobid) < 0);
 	sh_stats(STAT_FORKS);
+	if(parent)
+	{
+		sh_statshist(forkhist,start);
+		sh_profcount(PROF_FORK);
+	}
 	sig = sh.savesig;
 	sh.savesig = 0;
 	if(sig>0)
@@ -3103,6 +3339,7 @@ int sh_funscope(int argn, char *argv[],int(*fun)(void*),void *arg,int execflg)
 	jmpval = sigsetjmp(buffp->buff,0);
 	if(jmpval == 0)
 	{
+		sh_profcall(argv[0],sh.st.filename,fp && fp->node->nvalue.rp ? fp->node->nvalue.rp->lineno : error_info.line);
 		if(sh.fn_depth >= MAXDEPTH)
 		{
 			sh.toomany = 1;
@@ -3134,6 +3371,7 @@ int sh_funscope(int argn, char *argv[],int(*fun)(void*),void *arg,int execflg)
 			r = sh.exitval;
 		}
 	}
+	sh_profreturn();
 	sh.invoc_local = save_invoc_local;
 	sh.fn_depth--;
 	update_sh_level();
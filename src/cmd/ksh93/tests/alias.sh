@@ -161,6 +161,7 @@ got=$(
 	"(got $(printf %q "$got"))"
 
 # Listing members of the hash table with 'alias -pt' should work
+# (the hash table is unordered, so sort the full listing)
 exp='alias -t cat
 ls: tracked alias not found
 alias -t cat
@@ -170,7 +171,7 @@ got=$(
 	redirect 2>&1
 	hash -r cat chmod
 	alias -pt cat ls  # ls shouldn't be added to the hash table
-	alias -pt
+	alias -pt | sort
 )
 [[ $exp == $got ]] || err_exit "Listing members of the hash table with 'alias -pt' doesn't work" \
 	"(expected $(printf %q "$exp"), got $(printf %q "$got"))"
@@ -304,5 +305,32 @@ got=$({ "$SHELL" -i -c 'alias r=foo; ./script'; } 2>&1) \
 || err_exit "crash on running script after redefining predefined alias (got $(printf %q "$got"))"
 fi # !SHOPT_SCRIPTONLY
 
+# ======
+# The hash table must keep all tracked aliases while it grows, while subshells add
+# and delete their own on top of it, and when it is emptied for a script without #!
+mkdir "$tmp/trackbin" && for ((i=0; i<300; i++))
+do	print : >"$tmp/trackbin/c$i" && chmod +x "$tmp/trackbin/c$i" || break
+done
+print $'hash c7 c8\nhash | grep -c "^c"' >"$tmp/trackbin/noshebang" && chmod +x "$tmp/trackbin/noshebang"
+exp=$(for ((i=0; i<300; i++)); do print "c$i=$tmp/trackbin/c$i"; done | sort)
+got=$("$SHELL" -c '
+	PATH=$1:$PATH
+	hash -r
+	for ((i=0; i<300; i++)); do hash c$i; done
+	hash | grep "^c" | sort
+	for ((j=0; j<4; j++))
+	do	(for ((i=0; i<300; i+=3)); do hash c$i; done; PATH=$PATH; for ((i=j; i<300; i+=2)); do hash c$i; done; hash | grep -c "^c")
+	done
+	noshebang
+	hash | grep -c "^c"
+	PATH=$PATH
+	hash | grep -c "^c"
+	for ((i=299; i>=0; i--)); do hash c$i; done
+	hash | grep "^c" | sort
+' ksh "$tmp/trackbin" 2>&1)
+exp=$exp$'\n150\n150\n149\n149\n2\n300\n0\n'$exp
+[[ $got == "$exp" ]] || err_exit "hash table loses or duplicates tracked aliases" \
+	"(expected $(printf %q "$exp"), got $(printf %q "$got"))"
+
 # ======
 exit $((Errors<125?Errors:125))
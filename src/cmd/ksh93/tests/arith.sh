@@ -1057,5 +1057,31 @@ integer 20 got=$exp
 [[ $got == "$exp" ]] || err_exit "negative base-20 number (expected '$exp', got '$got')"
 unset got
 
+# ======
+# floating point conversions are correctly rounded in both directions
+if	(( 1 + 2**-63 != 1 && 1 + 2**-64 == 1 ))	# 64-bit long double mantissa
+then	exp='100000000000000000000000 2360000000000000000000 0.100000000000000000001 2.49999999999999999999e-300'
+	got=$(printf '%.25g %.25g %.21g %.20e' 1e23 2.36e+21 0.1 2.5e-300)
+	[[ $got == "$exp" ]] || err_exit "floating point output not correctly rounded" \
+		"(expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	exp='1.23456789012345678900e-21 0.333333333333333333342'
+	got=$(printf '%.20e %.21g' 123456789012345678901234567890e-50 0.333333333333333333342)
+	[[ $got == "$exp" ]] || err_exit "floating point input not correctly rounded" \
+		"(expected $(printf %q "$exp"), got $(printf %q "$got"))"
+fi
+
+# ======
+# decimal integers of every length convert exactly in both directions
+for exp in 7 12345678 123456789 1234567890123456 -12345678901234567 9223372036854775807 -9223372036854775808
+do	integer -l got=$exp
+	[[ $got == "$exp" ]] || err_exit "integer conversion of $exp (got $got)"
+	unset got
+done
+for exp in 7 -12345678 123456789 1234567890123456 12345678901234567
+do	(( got = exp ))
+	[[ $got == "$exp" ]] || err_exit "arithmetic assignment of $exp to a string variable (got $got)"
+	unset got
+done
+
 # ======
 exit $((Errors<125?Errors:125))
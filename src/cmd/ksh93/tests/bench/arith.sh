@@ -0,0 +1,42 @@
+########################################################################
+#                                                                      #
+#              This file is part of the ksh 93u+m package              #
+#          Copyright (c) 2026 Contributors to ksh 93u+m                #
+#                      and is licensed under the                       #
+#                 Eclipse Public License, Version 2.0                  #
+#                                                                      #
+#                A copy of the License is available at                 #
+#      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      #
+#         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         #
+#                                                                      #
+#                  Martijn Dekker <martijn@inlv.org>                   #
+#                                                                      #
+########################################################################
+
+# Benchmarks for arithmetic
+
+function bench_integer
+{
+	integer i x=0 n=200000*scale
+	for ((i=0; i<n; i++))
+	do	((x = (x * 31 + i) % 1000003))
+	done
+}
+
+function bench_float
+{
+	integer i n=100000*scale
+	typeset -F x=0
+	for ((i=0; i<n; i++))
+	do	((x = x * 1.000001 + sqrt(i)))
+	done
+}
+
+function bench_string_operands
+{
+	integer i n=100000*scale
+	typeset a=12 b=34 c
+	for ((i=0; i<n; i++))
+	do	c=$((a * b + i))
+	done
+}
@@ -0,0 +1,71 @@
+########################################################################
+#                                                                      #
+#              This file is part of the ksh 93u+m package              #
+#          Copyright (c) 2026 Contributors to ksh 93u+m                #
+#                      and is licensed under the                       #
+#                 Eclipse Public License, Version 2.0                  #
+#                                                                      #
+#                A copy of the License is available at                 #
+#      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      #
+#         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         #
+#                                                                      #
+#                  Martijn Dekker <martijn@inlv.org>                   #
+#                                                                      #
+########################################################################
+
+# Benchmarks for indexed and associative arrays
+
+function bench_indexed_assign
+{
+	integer i n=200000*scale
+	typeset -a a
+	for ((i=0; i<n; i++))
+	do	a[i]=$i
+	done
+}
+
+function bench_indexed_read
+{
+	integer i s n=200000*scale
+	typeset -a a=({1..1000})
+	for ((i=0; i<n; i++))
+	do	s=${a[i%1000]}
+	done
+}
+
+function bench_assoc_assign
+{
+	integer i n=100000*scale
+	typeset -A a
+	for ((i=0; i<n; i++))
+	do	a[key$i]=$i
+	done
+}
+
+function bench_assoc_lookup
+{
+	integer i n=100000*scale
+	typeset -A a
+	typeset v
+	for ((i=0; i<1000; i++))
+	do	a[key$i]=$i
+	done
+	for ((i=0; i<n; i++))
+	do	v=${a[key$((i%1000))]}
+	done
+}
+
+function bench_assoc_iterate
+{
+	integer i n=100*scale
+	typeset -A a
+	typeset k
+	for ((i=0; i<1000; i++))
+	do	a[key$i]=$i
+	done
+	for ((i=0; i<n; i++))
+	do	for k in "${!a[@]}"
+		do	: ${a[$k]}
+		done
+	done
+}
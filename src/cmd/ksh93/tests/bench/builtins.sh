@@ -0,0 +1,40 @@
+########################################################################
+#                                                                      #
+#              This file is part of the ksh 93u+m package              #
+#          Copyright (c) 2026 Contributors to ksh 93u+m                #
+#                      and is licensed under the                       #
+#                 Eclipse Public License, Version 2.0                  #
+#                                                                      #
+#                A copy of the License is available at                 #
+#      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      #
+#         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         #
+#                                                                      #
+#                  Martijn Dekker <martijn@inlv.org>                   #
+#                                                                      #
+########################################################################
+
+# Benchmarks for option parsing by built-in commands
+
+function bench_builtins_plain
+{
+	integer i n=50000*scale
+	typeset v w
+	for ((i=0; i<n; i++))
+	do	print x
+		printf '%s\n' x
+		typeset v=x
+		let v=i
+	done > /dev/null
+}
+
+function bench_builtins_options
+{
+	integer i n=50000*scale
+	typeset v w
+	for ((i=0; i<n; i++))
+	do	print -rn -- x
+		printf -v v '%s' x
+		typeset -i v=1
+		unset -v w
+	done > /dev/null
+}
@@ -0,0 +1,289 @@
+/***********************************************************************
+*                                                                      *
+*               This software is part of the ast package               *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
+*                      and is licensed under the                       *
+*                 Eclipse Public License, Version 2.0                  *
+*                                                                      *
+*                A copy of the License is available at                 *
+*      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      *
+*         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         *
+*                                                                      *
+*                  Martijn Dekker <martijn@inlv.org>                   *
+*                                                                      *
+***********************************************************************/
+/*
+ * cdt micro-benchmark: times insert, search (found and not found) and
+ * delete of string-keyed objects for the Dtset, Dtpset, Dtpbag and Dtoset
+ * methods, and checks the results of each operation. The rounds of the
+ * methods alternate, so that a change in machine load affects them all
+ * alike. Before that, it checks what the timing rounds do not reach for
+ * the open-addressing methods Dtpset and Dtpbag: duplicate keys, walks,
+ * and deletes and inserts at full load that leave and reuse tombstones.
+ * The exit status is 1 if any result is wrong. Build it against the libast
+ * of an arch/$HOSTTYPE tree from the top directory of the source, e.g.:
+ *
+ *	a=arch/$(bin/package host)
+ *	cc -O2 -I$a/include/ast -o cdtbench src/cmd/ksh93/tests/bench/cdt.c $a/lib/libast.a -lm
+ *	./cdtbench [objects [rounds]]
+ *
+ * Each line gives the median time per operation in nanoseconds.
+ */
+
+#include	<ast.h>
+#include	<cdt.h>
+#include	<time.h>
+
+typedef struct Obj_s
+{
+	Dtlink_t	link;
+	char		key[16];
+} Obj_t;
+
+static Dtdisc_t	disc =
+{
+	offsetof(Obj_t,key), 0, offsetof(Obj_t,link)
+};
+
+static struct
+{
+	const char	*name;
+	Dtmethod_t	**meth;
+} methods[] =
+{
+	"Dtset",	&Dtset,
+	"Dtpset",	&Dtpset,
+	"Dtpbag",	&Dtpbag,
+	"Dtoset",	&Dtoset,
+};
+
+enum { INSERT, FOUND, NOTFOUND, DELETE, NOPS };
+
+static const char *opnames[NOPS] = { "insert", "found", "not found", "delete" };
+
+static double now(void)
+{
+	struct timespec	ts;
+	clock_gettime(CLOCK_MONOTONIC,&ts);
+	return ts.tv_sec*1e9 + ts.tv_nsec;
+}
+
+static void fail(const char *meth, const char *op, long i)
+{
+	sfprintf(sfstderr,"cdtbench: %s: %s: wrong result for object %ld\n",meth,op,i);
+	exit(1);
+}
+
+/*
+ * time one round of each operation on n objects in the order of <order>
+ */
+static void timeround(Dt_t *dt, const char *name, Obj_t *obj, Obj_t *miss, long *order, long n, double *t)
+{
+	double	start;
+	long	i;
+	start = now();
+	for(i = 0; i < n; i++)
+		if(dtinsert(dt,&obj[order[i]]) != &obj[order[i]])
+			fail(name,opnames[INSERT],i);
+	t[INSERT] = (now()-start)/n;
+	if(dtsize(dt) != n)
+		fail(name,"size",n);
+	start = now();
+	for(i = n-1; i >= 0; i--)
+		if(dtmatch(dt,obj[order[i]].key) != &obj[order[i]])
+			fail(name,opnames[FOUND],i);
+	t[FOUND] = (now()-start)/n;
+	start = now();
+	for(i = 0; i < n; i++)
+		if(dtmatch(dt,miss[i].key))
+			fail(name,opnames[NOTFOUND],i);
+	t[NOTFOUND] = (now()-start)/n;
+	start = now();
+	for(i = 0; i < n; i++)
+		if(dtdelete(dt,&obj[i]) != &obj[i])
+			fail(name,opnames[DELETE],i);
+	t[DELETE] = (now()-start)/n;
+	if(dtsize(dt) != 0)
+		fail(name,"size",0);
+}
+
+static ssize_t tablespace(Dt_t *dt)
+{
+	Dtstat_t	st;
+	(*_DT(dt)->searchf)(dt,&st,DT_STAT);
+	return st.space;
+}
+
+/*
+ * walk <dt> and check that it holds obj[0..n-1] once each, and <ndup>
+ * more objects with the key of obj[0]; <seen> has room for n flags
+ */
+static void checkwalk(Dt_t *dt, const char *name, Obj_t *obj, long n, long ndup, char *seen)
+{
+	Obj_t	*op;
+	long	i, k = 0;
+	memset(seen,0,n);
+	for(op = dtfirst(dt); op; op = dtnext(dt,op))
+	{
+		i = op - obj;
+		if(i >= 0 && i < n && !seen[i])
+			seen[i] = 1;
+		else if(strcmp(op->key,obj[0].key) || ++k > ndup)
+			fail(name,"walk",i);
+	}
+	for(i = 0; i < n; i++)
+		if(!seen[i])
+			fail(name,"walk",i);
+	if(k != ndup || dtsize(dt) != n+ndup)
+		fail(name,"size",n+ndup);
+}
+
+/*
+ * check Dtpset and Dtpbag beyond what the timing rounds do
+ */
+static void checkprobe(Obj_t *obj, long n)
+{
+	Dt_t	*dt;
+	Obj_t	dup[3], *op;
+	char	*seen;
+	ssize_t	space;
+	long	i, r;
+	int	bag;
+	if(!(seen = malloc(n)))
+	{
+		sfprintf(sfstderr,"cdtbench: out of memory\n");
+		exit(1);
+	}
+	for(i = 0; i < elementsof(dup); i++)
+		memcpy(dup[i].key,obj[0].key,sizeof(dup[i].key));
+	for(bag = 0; bag < 2; bag++)
+	{
+		const char *name = bag ? "Dtpbag" : "Dtpset";
+		if(!(dt = dtopen(&disc,bag ? Dtpbag : Dtpset)))
+			fail(name,"open",0);
+		for(i = 0; i < n; i++)
+			if(dtinsert(dt,&obj[i]) != &obj[i])
+				fail(name,"insert",i);
+		/* a set keeps the first object with a key, a bag keeps them all */
+		for(i = 0; i < elementsof(dup); i++)
+			if(dtinsert(dt,&dup[i]) != (bag ? &dup[i] : &obj[0]))
+				fail(name,"insert duplicate",i);
+		checkwalk(dt,name,obj,n,bag ? elementsof(dup) : 0,seen);
+		if(bag)
+		{
+			if(dtremove(dt,&dup[1]) != &dup[1] || dtremove(dt,&dup[1]))
+				fail(name,"remove duplicate",1);
+			for(i = 0; i < 3; i++)
+				if(!(op = dtdelete(dt,&dup[0])) || strcmp(op->key,obj[0].key) || op == &dup[1])
+					fail(name,"delete duplicate",i);
+			if(dtmatch(dt,obj[0].key))
+				fail(name,"delete duplicate",3);
+			if(dtinsert(dt,&obj[0]) != &obj[0])
+				fail(name,"insert",0);
+			checkwalk(dt,name,obj,n,0,seen);
+		}
+		/*
+		 * delete a third of the objects and insert them again, eight times over;
+		 * deleting from a full group leaves a tombstone that later searches
+		 * must pass and that a later insert may take; the table must not grow
+		 */
+		space = tablespace(dt);
+		for(r = 0; r < 8; r++)
+		{
+			for(i = r%3; i < n; i += 3)
+				if(dtdelete(dt,&obj[i]) != &obj[i])
+					fail(name,"delete",i);
+			for(i = 0; i < n; i++)
+				if(dtmatch(dt,obj[i].key) != (i%3 == r%3 ? NULL : &obj[i]))
+					fail(name,"search after delete",i);
+			for(i = r%3; i < n; i += 3)
+				if(dtinsert(dt,&obj[i]) != &obj[i])
+					fail(name,"insert after delete",i);
+			for(i = 0; i < n; i++)
+				if(dtmatch(dt,obj[i].key) != &obj[i])
+					fail(name,"search after insert",i);
+		}
+		if(tablespace(dt) != space)
+			fail(name,"table size",n);
+		checkwalk(dt,name,obj,n,0,seen);
+		dtclose(dt);
+	}
+	free(seen);
+}
+
+static int cmpdouble(const void *a, const void *b)
+{
+	double	x = *(double*)a, y = *(double*)b;
+	return x < y ? -1 : x > y;
+}
+
+int main(int argc, char *argv[])
+{
+	long	n = argc > 1 ? strtol(argv[1],NULL,10) : 100000;
+	int	rounds = argc > 2 ? atoi(argv[2]) : 7;
+	Obj_t	*obj, *miss;
+	long	*order, i, j, k;
+	double	(*t)[NOPS];
+	double	*v;
+	Dt_t	*dt[elementsof(methods)];
+	int	m, op, r;
+	if(n < 1 || rounds < 1)
+	{
+		sfprintf(sfstderr,"Usage: cdtbench [objects [rounds]]\n");
+		return 2;
+	}
+	obj = calloc(n,sizeof(Obj_t));
+	miss = calloc(n,sizeof(Obj_t));
+	order = calloc(n,sizeof(long));
+	t = calloc(elementsof(methods)*rounds,sizeof(*t));
+	v = calloc(rounds,sizeof(double));
+	if(!obj || !miss || !order || !t || !v)
+	{
+		sfprintf(sfstderr,"cdtbench: out of memory\n");
+		return 1;
+	}
+	for(i = 0; i < n; i++)
+	{
+		sfsprintf(obj[i].key,sizeof(obj[i].key),"key%ld",i);
+		sfsprintf(miss[i].key,sizeof(miss[i].key),"miss%ld",i);
+		order[i] = i;
+	}
+	/* insert in a fixed pseudo-random order */
+	srand(1);
+	for(i = n-1; i > 0; i--)
+	{
+		j = rand() % (i+1);
+		k = order[i];
+		order[i] = order[j];
+		order[j] = k;
+	}
+	checkprobe(obj,n);
+	sfprintf(sfstdout,"%ld objects, median of %d rounds, ns/operation\n",n,rounds);
+	sfprintf(sfstdout,"%-8s","");
+	for(op = 0; op < NOPS; op++)
+		sfprintf(sfstdout," %10s",opnames[op]);
+	sfputc(sfstdout,'\n');
+	for(m = 0; m < elementsof(methods); m++)
+		if(!(dt[m] = dtopen(&disc,*methods[m].meth)))
+		{
+			sfprintf(sfstderr,"cdtbench: %s: cannot open dictionary\n",methods[m].name);
+			return 1;
+		}
+	for(r = 0; r < rounds; r++)
+		for(m = 0; m < elementsof(methods); m++)
+			timeround(dt[m],methods[m].name,obj,miss,order,n,t[m*rounds+r]);
+	for(m = 0; m < elementsof(methods); m++)
+	{
+		dtclose(dt[m]);
+		sfprintf(sfstdout,"%-8s",methods[m].name);
+		for(op = 0; op < NOPS; op++)
+		{
+			for(r = 0; r < rounds; r++)
+				v[r] = t[m*rounds+r][op];
+			qsort(v,rounds,sizeof(double),cmpdouble);
+			sfprintf(sfstdout," %10.1f",v[rounds/2]);
+		}
+		sfputc(sfstdout,'\n');
+	}
+	return 0;
+}
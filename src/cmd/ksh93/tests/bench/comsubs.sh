@@ -0,0 +1,61 @@
+########################################################################
+#                                                                      #
+#              This file is part of the ksh 93u+m package              #
+#          Copyright (c) 2026 Contributors to ksh 93u+m                #
+#                      and is licensed under the                       #
+#                 Eclipse Public License, Version 2.0                  #
+#                                                                      #
+#                A copy of the License is available at                 #
+#      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      #
+#         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         #
+#                                                                      #
+#                  Martijn Dekker <martijn@inlv.org>                   #
+#                                                                      #
+########################################################################
+
+# Benchmarks for command substitutions and subshells
+
+function bench_builtin
+{
+	integer i n=30000*scale
+	typeset x
+	for ((i=0; i<n; i++))
+	do	x=$(print hello)
+	done
+}
+
+function bench_shared
+{
+	integer i n=100000*scale
+	typeset x
+	for ((i=0; i<n; i++))
+	do	x=${ print hello; }
+	done
+}
+
+function bench_forked
+{
+	integer i n=300*scale
+	typeset x
+	for ((i=0; i<n; i++))
+	do	x=$(ulimit -t unlimited; print hello)
+	done
+}
+
+function bench_external
+{
+	integer i n=300*scale
+	typeset x
+	for ((i=0; i<n; i++))
+	do	x=$(/bin/echo hello)
+	done
+}
+
+function bench_virtual_subshell
+{
+	integer i n=30000*scale
+	typeset x=1
+	for ((i=0; i<n; i++))
+	do	(x=2)
+	done
+}
@@ -0,0 +1,43 @@
+########################################################################
+#                                                                      #
+#              This file is part of the ksh 93u+m package              #
+#          Copyright (c) 2026 Contributors to ksh 93u+m                #
+#                      and is licensed under the                       #
+#                 Eclipse Public License, Version 2.0                  #
+#                                                                      #
+#                A copy of the License is available at                 #
+#      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      #
+#         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         #
+#                                                                      #
+#                  Martijn Dekker <martijn@inlv.org>                   #
+#                                                                      #
+########################################################################
+
+# Benchmarks for enumeration types
+
+integer _i
+typeset -a Region_t
+for ((_i=0; _i<5000; _i++))
+do	Region_t+=("region_$_i")
+done
+enum Region_t
+enum -i Case_t=("${Region_t[@]}")
+unset _i
+
+function bench_enum_assign
+{
+	integer i n=100000*scale
+	Region_t r
+	for ((i=0; i<n; i++))
+	do	r=region_$((i%5000))
+	done
+}
+
+function bench_enum_assign_icase
+{
+	integer i n=100000*scale
+	Case_t r
+	for ((i=0; i<n; i++))
+	do	r=REGION_$((i%5000))
+	done
+}
@@ -0,0 +1,69 @@
+########################################################################
+#                                                                      #
+#              This file is part of the ksh 93u+m package              #
+#          Copyright (c) 2026 Contributors to ksh 93u+m                #
+#                      and is licensed under the                       #
+#                 Eclipse Public License, Version 2.0                  #
+#                                                                      #
+#                A copy of the License is available at                 #
+#      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      #
+#         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         #
+#                                                                      #
+#                  Martijn Dekker <martijn@inlv.org>                   #
+#                                                                      #
+########################################################################
+
+# Benchmarks for file test operators on a directory of files
+
+integer _i
+mkdir -p files
+for ((_i=0; _i<1000; _i++))
+do	print $_i > files/f$_i
+done
+: > files/ref
+unset _i
+
+function bench_filetest_chain
+{
+	integer i n
+	typeset f
+	for ((i=0; i<20*scale; i++))
+	do	for f in files/*
+		do	[[ -f $f && -r $f && -s $f && $f -nt files/ref ]] && ((n++))
+		done
+	done
+}
+
+function bench_filetest_builtin
+{
+	integer i n
+	typeset f
+	for ((i=0; i<20*scale; i++))
+	do	for f in files/*
+		do	test -e "$f" -a -f "$f" -a -w "$f" && ((n++))
+		done
+	done
+}
+
+function bench_filestat
+{
+	integer i j n
+	typeset -a st
+	for ((i=0; i<20*scale; i++))
+	do	/opt/ast/bin/filestat st files/*
+		for ((j=0; j<${#st[@]}; j++))
+		do	((n += st[j].size))
+		done
+	done
+}
+
+function bench_filestat_external
+{
+	integer i n
+	typeset f
+	for ((i=0; i<scale; i++))
+	do	for f in files/*
+		do	((n += $(stat -c %s "$f")))
+		done
+	done
+}
@@ -0,0 +1,68 @@
+########################################################################
+#                                                                      #
+#              This file is part of the ksh 93u+m package              #
+#          Copyright (c) 2026 Contributors to ksh 93u+m                #
+#                      and is licensed under the                       #
+#                 Eclipse Public License, Version 2.0                  #
+#                                                                      #
+#                A copy of the License is available at                 #
+#      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      #
+#         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         #
+#                                                                      #
+#                  Martijn Dekker <martijn@inlv.org>                   #
+#                                                                      #
+########################################################################
+
+# Benchmarks for shell function calls
+
+posixfn() { :; }
+function kshfn { :; }
+function kshlocal
+{
+	typeset a=1 b=2 c=3
+	: $a $b $c
+}
+function fib
+{
+	if	(($1 < 2))
+	then	REPLY=$1
+		return
+	fi
+	typeset -i a
+	fib $(($1 - 1))
+	a=REPLY
+	fib $(($1 - 2))
+	((REPLY += a))
+}
+
+function bench_posix_call
+{
+	integer i n=100000*scale
+	for ((i=0; i<n; i++))
+	do	posixfn
+	done
+}
+
+function bench_ksh_call
+{
+	integer i n=100000*scale
+	for ((i=0; i<n; i++))
+	do	kshfn
+	done
+}
+
+function bench_ksh_locals
+{
+	integer i n=50000*scale
+	for ((i=0; i<n; i++))
+	do	kshlocal
+	done
+}
+
+function bench_recursion
+{
+	integer i
+	for ((i=0; i<scale; i++))
+	do	fib 20
+	done
+}
@@ -0,0 +1,187 @@
+/***********************************************************************
+*                                                                      *
+*               This software is part of the ast package               *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
+*                      and is licensed under the                       *
+*                 Eclipse Public License, Version 2.0                  *
+*                                                                      *
+*                A copy of the License is available at                 *
+*      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      *
+*         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         *
+*                                                                      *
+*                  Martijn Dekker <martijn@inlv.org>                   *
+*                                                                      *
+***********************************************************************/
+/*
+ * String hash benchmark and quality check for dtstrhash(3), which is also
+ * used by strhash(3) and memhash(3). It is compared to FNV-1a and to the
+ * HASHPART linear congruential hash, the functions it replaced.
+ *
+ * For each of several sets of typical shell keys it counts the pairs of
+ * keys with equal 32-bit hash values and the chi-square deviation of the
+ * number of keys per bucket, for 65536 buckets taken from the low and from
+ * the high bits. It then times the hashing of strings of various lengths.
+ * The exit status is 1 if dtstrhash has more collisions or a worse bucket
+ * distribution than a good hash function plausibly could. Build it against
+ * the libast of an arch/$HOSTTYPE tree from the top directory of the source:
+ *
+ *	a=arch/$(bin/package host)
+ *	cc -O2 -I$a/include/ast -o hashbench src/cmd/ksh93/tests/bench/hash.c $a/lib/libast.a -lm
+ *	./hashbench [keys]
+ */
+
+#include	<ast.h>
+#include	<cdt.h>
+#include	<hashpart.h>
+#include	<math.h>
+#include	<time.h>
+
+#define NBUCKET	65536
+#define NKEY	4096	/* strings per timing run */
+
+static unsigned int fnv(const char *s)
+{
+	unsigned int	h = 2166136261U;
+	while(*s)
+		h = (h ^ (unsigned char)*s++) * 16777619U;
+	return h;
+}
+
+static unsigned int hashpart(const char *s)
+{
+	unsigned int	h = 0, c;
+	while((c = (unsigned char)*s++))
+		HASHPART(h,c);
+	return h;
+}
+
+static unsigned int dtstr(const char *s)
+{
+	return dtstrhash(0,(void*)s,-1);
+}
+
+static struct
+{
+	const char	*name;
+	unsigned int	(*hashf)(const char*);
+} funs[] =
+{
+	"dtstrhash",	dtstr,
+	"fnv1a",	fnv,
+	"hashpart",	hashpart,
+};
+
+static const char *sets[] = { "key%ld", "%ld", "name", "/usr/local/lib/pkg%ld/file.so" };
+
+static char *key(int set, long i, char *buf)
+{
+	int	k = 0;
+	if(sets[set][0] != 'n')
+		sfsprintf(buf,64,sets[set],i);
+	else	/* distinct identifiers: a letter, then letters and digits */
+	{
+		buf[k++] = 'a' + i%26;
+		for(i /= 26; i > 0; i = (i-1)/36)
+			buf[k++] = "abcdefghijklmnopqrstuvwxyz0123456789"[(i-1)%36];
+		buf[k] = 0;
+	}
+	return buf;
+}
+
+static int cmpuint(const void *a, const void *b)
+{
+	unsigned int	x = *(unsigned int*)a, y = *(unsigned int*)b;
+	return x < y ? -1 : x > y;
+}
+
+/*
+ * chi-square deviation from a uniform distribution over NBUCKET buckets
+ * in standard deviations
+ */
+static double chisq(unsigned int *h, long n, int shift)
+{
+	static long	count[NBUCKET];
+	double		e = (double)n/NBUCKET, x = 0;
+	long		i;
+	memset(count,0,sizeof(count));
+	for(i = 0; i < n; i++)
+		count[(h[i]>>shift)&(NBUCKET-1)]++;
+	for(i = 0; i < NBUCKET; i++)
+		x += (count[i]-e)*(count[i]-e)/e;
+	return (x-(NBUCKET-1))/sqrt(2.0*(NBUCKET-1));
+}
+
+static double now(void)
+{
+	struct timespec	ts;
+	clock_gettime(CLOCK_MONOTONIC,&ts);
+	return ts.tv_sec*1e9 + ts.tv_nsec;
+}
+
+int main(int argc, char *argv[])
+{
+	long		n = argc > 1 ? strtol(argv[1],NULL,10) : 1000000;
+	static const int lens[] = { 3, 8, 16, 32, 100 };
+	unsigned int	*h, sink = 0;
+	static char	str[NKEY][128];
+	char		buf[64];
+	double		expect, lo, hi, start, best, t;
+	long		i, k, coll;
+	int		f, s, l, r, bad = 0;
+	if(n < 1000 || !(h = calloc(n,sizeof(*h))))
+	{
+		sfprintf(sfstderr,"Usage: hashbench [keys>=1000]\n");
+		return 2;
+	}
+	expect = (double)n*(n-1)/2/4294967296.0;
+	sfprintf(sfstdout,"%ld keys; expected colliding pairs %.1f; chi-square in sigmas\n",n,expect);
+	sfprintf(sfstdout,"%-32s %-10s %10s %8s %8s\n","keys","hash","collisions","low","high");
+	for(s = 0; s < elementsof(sets); s++)
+		for(f = 0; f < elementsof(funs); f++)
+		{
+			for(i = 0; i < n; i++)
+				h[i] = (*funs[f].hashf)(key(s,i,buf));
+			lo = chisq(h,n,0);
+			hi = chisq(h,n,32-16);
+			qsort(h,n,sizeof(*h),cmpuint);
+			for(coll = 0, i = 1; i < n; i++)
+				coll += h[i] == h[i-1];
+			sfprintf(sfstdout,"%-32s %-10s %10ld %8.1f %8.1f\n",sets[s],funs[f].name,coll,lo,hi);
+			/* a good hash: Poisson collisions, chi-square within ~6 sigmas */
+			if(f == 0 && (coll > 2*expect+4*sqrt(expect)+8 || lo > 6 || hi > 6))
+				bad++;
+		}
+	sfprintf(sfstdout,"\nns/hash, best of 5\n%-10s","");
+	for(l = 0; l < elementsof(lens); l++)
+		sfprintf(sfstdout," %7d",lens[l]);
+	sfputc(sfstdout,'\n');
+	for(f = 0; f < elementsof(funs); f++)
+	{
+		sfprintf(sfstdout,"%-10s",funs[f].name);
+		for(l = 0; l < elementsof(lens); l++)
+		{
+			for(i = 0; i < NKEY; i++)
+			{
+				for(k = 0; k < lens[l]; k++)
+					str[i][k] = 'a' + (i*7+k*13)%26;
+				str[i][k] = 0;
+			}
+			best = 0;
+			for(r = 0; r < 5; r++)
+			{
+				start = now();
+				for(k = 0; k < 250; k++)
+					for(i = 0; i < NKEY; i++)
+						sink += (*funs[f].hashf)(str[i]);
+				t = (now()-start)/(250*NKEY);
+				if(!r || t < best)
+					best = t;
+			}
+			sfprintf(sfstdout," %7.1f",best);
+		}
+		sfputc(sfstdout,'\n');
+	}
+	if(bad)
+		sfprintf(sfstdout,"dtstrhash: poor distribution for %d key sets\n",bad);
+	return bad != 0 || sink == 1;
+}
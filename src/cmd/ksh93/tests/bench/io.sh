@@ -0,0 +1,73 @@
+########################################################################
+#                                                                      #
+#              This file is part of the ksh 93u+m package              #
+#          Copyright (c) 2026 Contributors to ksh 93u+m                #
+#                      and is licensed under the                       #
+#                 Eclipse Public License, Version 2.0                  #
+#                                                                      #
+#                A copy of the License is available at                 #
+#      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      #
+#         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         #
+#                                                                      #
+#                  Martijn Dekker <martijn@inlv.org>                   #
+#                                                                      #
+########################################################################
+
+# Benchmarks for reading and writing files
+
+integer _i
+for ((_i=0; _i<20000; _i++))
+do	print -r -- "line $_i: the quick brown fox jumps over the lazy dog"
+done > lines.txt
+unset _i
+
+function bench_read_lines
+{
+	integer i
+	typeset line
+	for ((i=0; i<10*scale; i++))
+	do	while read -r line
+		do	:
+		done < lines.txt
+	done
+}
+
+function bench_read_fields
+{
+	integer i
+	typeset a b c
+	for ((i=0; i<10*scale; i++))
+	do	while read -r a b c
+		do	:
+		done < lines.txt
+	done
+}
+
+function bench_print_redirect
+{
+	integer i n=20000*scale
+	for ((i=0; i<n; i++))
+	do	print -r -- "line $i" >> out.txt
+	done
+	rm out.txt
+}
+
+function bench_print_block
+{
+	integer i n=200000*scale
+	for ((i=0; i<n; i++))
+	do	print -r -- "line $i"
+	done > out.txt
+	rm out.txt
+}
+
+function bench_heredoc
+{
+	integer i n=5000*scale
+	typeset line
+	for ((i=0; i<n; i++))
+	do	read -r line <<-EOF
+		value $i
+		EOF
+	done
+}
@@ -0,0 +1,62 @@
+########################################################################
+#                                                                      #
+#              This file is part of the ksh 93u+m package              #
+#          Copyright (c) 2026 Contributors to ksh 93u+m                #
+#                      and is licensed under the                       #
+#                 Eclipse Public License, Version 2.0                  #
+#                                                                      #
+#                A copy of the License is available at                 #
+#      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      #
+#         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         #
+#                                                                      #
+#                  Martijn Dekker <martijn@inlv.org>                   #
+#                                                                      #
+########################################################################
+
+# Benchmarks for loops and simple command execution in sh_exec()
+
+function bench_while_arith
+{
+	integer i=0 n=300000*scale
+	while ((i < n))
+	do	((i++))
+	done
+}
+
+function bench_for_arith
+{
+	integer i n=300000*scale
+	for ((i=0; i<n; i++))
+	do	:
+	done
+}
+
+function bench_for_list
+{
+	integer i n=10000*scale
+	typeset w list=$(printf 'word%d ' {1..100})
+	for ((i=0; i<n; i++))
+	do	for w in $list
+		do	:
+		done
+	done
+}
+
+function bench_builtins
+{
+	integer i n=100000*scale
+	for ((i=0; i<n; i++))
+	do	true
+		print -n
+		let 1
+	done
+}
+
+function bench_assignments
+{
+	integer i n=200000*scale
+	typeset a b c
+	for ((i=0; i<n; i++))
+	do	a=$i b=$a c=x$b
+	done
+}
@@ -0,0 +1,76 @@
+########################################################################
+#                                                                      #
+#              This file is part of the ksh 93u+m package              #
+#          Copyright (c) 2026 Contributors to ksh 93u+m                #
+#                      and is licensed under the                       #
+#                 Eclipse Public License, Version 2.0                  #
+#                                                                      #
+#                A copy of the License is available at                 #
+#      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      #
+#         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         #
+#                                                                      #
+#                  Martijn Dekker <martijn@inlv.org>                   #
+#                                                                      #
+########################################################################
+
+# Benchmarks for pattern matching and string expansion
+
+function bench_case_glob
+{
+	integer i n=100000*scale
+	typeset s
+	for ((i=0; i<n; i++))
+	do	s=file$i.txt
+		case $s in
+		*.c | *.h)	;;
+		file[0-9]*.@(txt|doc))	;;
+		esac
+	done
+}
+
+function bench_test_glob
+{
+	integer i n=100000*scale
+	typeset s=/usr/local/share/doc/example.txt
+	for ((i=0; i<n; i++))
+	do	[[ $s == */doc/*.txt ]]
+		[[ $s == *.@(c|h) ]]
+	done
+}
+
+function bench_test_regex
+{
+	integer i n=100000*scale
+	typeset s=abc123def
+	for ((i=0; i<n; i++))
+	do	[[ $s =~ ^[a-z]+([0-9]+) ]]
+	done
+}
+
+function bench_substitution
+{
+	integer i n=50000*scale
+	typeset s=/usr/local/share/doc/example.txt t
+	for ((i=0; i<n; i++))
+	do	t=${s##*/} t=${s%.*} t=${s//o/0} t=${s/#\/usr/} t=${s:5:10}
+	done
+}
+
+function bench_field_split
+{
+	integer i n=20000*scale
+	typeset IFS=: line=a:bb:ccc:dddd:eeeee:ffffff
+	typeset -a f
+	for ((i=0; i<n; i++))
+	do	f=($line)
+	done
+}
+
+function bench_field_split_large
+{
+	integer i n=200*scale
+	typeset big=$(printf 'word%d ' {1..5000})
+	for ((i=0; i<n; i++))
+	do	: $big
+	done
+}
@@ -0,0 +1,40 @@
+########################################################################
+#                                                                      #
+#              This file is part of the ksh 93u+m package              #
+#          Copyright (c) 2026 Contributors to ksh 93u+m                #
+#                      and is licensed under the                       #
+#                 Eclipse Public License, Version 2.0                  #
+#                                                                      #
+#                A copy of the License is available at                 #
+#      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      #
+#         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         #
+#                                                                      #
+#                  Martijn Dekker <martijn@inlv.org>                   #
+#                                                                      #
+########################################################################
+
+# Benchmarks for pipelines
+
+function bench_builtin_pipe
+{
+	integer i n=500*scale
+	for ((i=0; i<n; i++))
+	do	print hello | read x
+	done
+}
+
+function bench_external_pipe
+{
+	integer i n=200*scale
+	for ((i=0; i<n; i++))
+	do	print hello | cat | cat >/dev/null
+	done
+}
+
+function bench_bulk_pipe
+{
+	integer i
+	for ((i=0; i<scale; i++))
+	do	printf '%s\n' {1..20000} | while read -r x; do :; done
+	done
+}
@@ -0,0 +1,236 @@
+/***********************************************************************
+*                                                                      *
+*               This software is part of the ast package               *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
+*                      and is licensed under the                       *
+*                 Eclipse Public License, Version 2.0                  *
+*                                                                      *
+*                A copy of the License is available at                 *
+*      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      *
+*         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         *
+*                                                                      *
+*                  Martijn Dekker <martijn@inlv.org>                   *
+*                                                                      *
+***********************************************************************/
+/*
+ * sfprintf(3) check and micro-benchmark. sfvprintf() prints formats with
+ * nothing but literal text, %%, plain %s and %d/%i/%u (with an optional
+ * l, ll, j or z size) without its general formatting engine.
+ *
+ * The check prints each test format and expects a fixed result. Where the
+ * format is one for the fast path, it also prints the same format with a
+ * field width of 1 inserted into every conversion, which sends it through
+ * the general engine, and expects the same result from that. It covers the
+ * integer extremes, the j and z sizes, a null and a precision-truncated
+ * %s, width and '-' padding, formats that the fast path must turn down
+ * because of a later conversion, and output that crosses buffer boundaries.
+ * The exit status is 1 if any result differs.
+ *
+ * The benchmark then times sfsprintf() for formats on and off the fast
+ * path. Build it against the libast of an arch/$HOSTTYPE tree from the top
+ * directory of the source, e.g.:
+ *
+ *	a=arch/$(bin/package host)
+ *	cc -O2 -I$a/include/ast -o sfprintfbench src/cmd/ksh93/tests/bench/sfprintf.c $a/lib/libast.a -lm
+ *	./sfprintfbench [calls [rounds]]
+ *
+ * Each line gives the median time per call in nanoseconds.
+ */
+
+#include	<ast.h>
+#include	<stdint.h>
+#include	<time.h>
+
+static int	errors;
+
+static double now(void)
+{
+	struct timespec	ts;
+	clock_gettime(CLOCK_MONOTONIC,&ts);
+	return ts.tv_sec*1e9 + ts.tv_nsec;
+}
+
+/*
+ * copy <form> to <buf> with a field width of 1 in each conversion that
+ * has neither flags, width nor precision; return 0 if there is none
+ */
+static int slowform(char *buf, const char *form)
+{
+	int	n = 0;
+	while(*buf++ = *form)
+	{
+		if(*form++ != '%')
+			continue;
+		if(*form == '%')
+			*buf++ = *form++;
+		else if(strchr("sdiuljz",*form))
+		{
+			*buf++ = '1';
+			n++;
+		}
+	}
+	return n;
+}
+
+static void check(int line, const char *exp, const char *form, ...)
+{
+	char	slow[64], got[256];
+	va_list	ap;
+	va_start(ap,form);
+	sfvsprintf(got,sizeof(got),form,ap);
+	va_end(ap);
+	if(strcmp(got,exp))
+	{
+		sfprintf(sfstderr,"sfprintfbench: line %d: \"%s\": expected \"%s\", got \"%s\"\n",line,form,exp,got);
+		errors++;
+	}
+	if(!slowform(slow,form))
+		return;
+	va_start(ap,form);
+	sfvsprintf(got,sizeof(got),slow,ap);
+	va_end(ap);
+	if(strcmp(got,exp))
+	{
+		sfprintf(sfstderr,"sfprintfbench: line %d: \"%s\": expected \"%s\", got \"%s\"\n",line,slow,exp,got);
+		errors++;
+	}
+}
+
+#define CHECK(exp,...)	check(__LINE__,exp,__VA_ARGS__)
+
+static void checkall(void)
+{
+	char	big[10000], buf[16];
+	Sfio_t	*sp;
+	char	*s;
+	int	i;
+	CHECK("0","%d",0);
+	CHECK("-1 1","%d %i",-1,1);
+	CHECK("9 10 99 100","%d %d %u %u",9,10,99U,100U);
+	CHECK("-2147483648 2147483647","%d %d",INT_MIN,INT_MAX);
+	CHECK("4294967295","%u",UINT_MAX);
+	CHECK("-9223372036854775808","%lld",LLONG_MIN);
+	CHECK("9223372036854775807 18446744073709551615","%lld %llu",LLONG_MAX,ULLONG_MAX);
+	CHECK("-9223372036854775808","%jd",(intmax_t)INT64_MIN);
+	CHECK("18446744073709551615","%ju",(uintmax_t)UINT64_MAX);
+	CHECK("123456789 0 -42","%zu %zu %zd",(size_t)123456789,(size_t)0,(ssize_t)-42);
+	CHECK("-1234567 1234567","%ld %lu",-1234567L,1234567UL);
+	CHECK("abc","%s","abc");
+	CHECK("(null)","%s",(char*)0);
+	CHECK("a=1;b=-2\n","%s=%d;%s=%d\n","a",1,"b",-2);
+	CHECK("%d 100% x%","%%d %d%% %s%%",100,"x");
+	CHECK("literal text only","literal text only");
+	/* formats for the general engine */
+	CHECK("ab","%.2s","abcdef");
+	CHECK("","%.0s",(char*)0);
+	CHECK("   42|42   |","%5d|%-5d|",42,42);
+	CHECK("    ab|ab    |","%6s|%-6s|","ab","ab");
+	CHECK("-0042","%05d",-42);
+	CHECK("-9223372036854775808 |","%-21lld|",LLONG_MIN);
+	/* a conversion late in the format turns down the fast path for all of it */
+	CHECK("1 a     2|","%d %s %5d|",1,"a",2);
+	CHECK("a ff","%s %x","a",255);
+	CHECK("3 2.5","%d %.1f",3,2.5);
+	CHECK("-1 1.5","%d %g",-1,1.5);
+	/* truncation by sfsprintf() */
+	if(sfsprintf(buf,8,"%s%d","abcdef",1234) < 0 || strcmp(buf,"abcdef1"))
+	{
+		sfprintf(sfstderr,"sfprintfbench: line %d: truncated \"%%s%%d\": got \"%s\"\n",__LINE__,buf);
+		errors++;
+	}
+	/* a string stream grows across several buffers */
+	memset(big,'x',sizeof(big)-1);
+	big[sizeof(big)-1] = 0;
+	if(!(sp = sfstropen()))
+	{
+		sfprintf(sfstderr,"sfprintfbench: cannot open string stream\n");
+		exit(1);
+	}
+	for(i = 0; i < 3; i++)
+		sfprintf(sp,"%s%d",big,i);
+	s = sfstruse(sp);
+	if(strlen(s) != 3*(sizeof(big)) || s[sizeof(big)-1] != '0' || s[3*sizeof(big)-1] != '2')
+	{
+		sfprintf(sfstderr,"sfprintfbench: line %d: string stream output is wrong\n",__LINE__);
+		errors++;
+	}
+	sfclose(sp);
+}
+
+static struct
+{
+	const char	*name;
+	const char	*form;
+} forms[] =
+{
+	"%d",		"%d",
+	"%lld",		"%lld",
+	"%s",		"%s",
+	"literal",	"literal text",
+	"%s=%d\\n",	"%s=%d\n",
+	"%5d",		"%5d",
+	"%x",		"%x",
+};
+
+static int cmpdouble(const void *a, const void *b)
+{
+	double	x = *(double*)a, y = *(double*)b;
+	return x < y ? -1 : x > y;
+}
+
+int main(int argc, char *argv[])
+{
+	long	n = argc > 1 ? strtol(argv[1],NULL,10) : 200000;
+	int	rounds = argc > 2 ? atoi(argv[2]) : 7;
+	char	buf[64];
+	double	(*t)[elementsof(forms)];
+	double	*v;
+	double	start;
+	long	i;
+	int	f, r;
+	if(n < 1 || rounds < 1)
+	{
+		sfprintf(sfstderr,"Usage: sfprintfbench [calls [rounds]]\n");
+		return 2;
+	}
+	checkall();
+	if(errors)
+		return 1;
+	t = calloc(rounds,sizeof(*t));
+	v = calloc(rounds,sizeof(double));
+	if(!t || !v)
+	{
+		sfprintf(sfstderr,"sfprintfbench: out of memory\n");
+		return 1;
+	}
+	for(r = 0; r < rounds; r++)
+		for(f = 0; f < elementsof(forms); f++)
+		{
+			start = now();
+			switch(forms[f].form[1])
+			{
+			case 'l':
+				for(i = 0; i < n; i++)
+					sfsprintf(buf,sizeof(buf),forms[f].form,(Sflong_t)i*1000003);
+				break;
+			case 's':
+				for(i = 0; i < n; i++)
+					sfsprintf(buf,sizeof(buf),forms[f].form,"PATH",(int)i);
+				break;
+			default:
+				for(i = 0; i < n; i++)
+					sfsprintf(buf,sizeof(buf),forms[f].form,(int)i);
+				break;
+			}
+			t[r][f] = (now()-start)/n;
+		}
+	sfprintf(sfstdout,"%ld calls of sfsprintf, median of %d rounds, ns/call\n",n,rounds);
+	for(f = 0; f < elementsof(forms); f++)
+	{
+		for(r = 0; r < rounds; r++)
+			v[r] = t[r][f];
+		qsort(v,rounds,sizeof(double),cmpdouble);
+		sfprintf(sfstdout,"%-10s %8.1f\n",forms[f].name,v[rounds/2]);
+	}
+	return 0;
+}
@@ -2,7 +2,7 @@
 #                                                                      #
 #               This software is part of the ast package               #
 #          Copyright (c) 1982-2012 AT&T Intellectual Property          #
-#          Copyright (c) 2020-2023 Contributors to ksh 93u+m           #
+#          Copyright (c) 2020-2026 Contributors to ksh 93u+m           #
 #                      and is licensed under the                       #
 #                 Eclipse Public License, Version 2.0                  #
 #                                                                      #
@@ -590,5 +590,26 @@ p=\\
 [[ \\ == [$'!'X] ]] && err_exit "\\ mismatches \$'!'"
 [[ \\ == [$'^'X] ]] && err_exit "\\ mismatches \$'^'"
 
+# ======
+# File test operators reuse stat(2) results within one expression,
+# but not across anything that may change the file system
+: > "$tmp/stc"
+[[ -e $tmp/stc && $(rm "$tmp/stc") == '' && -e $tmp/stc ]] && err_exit "[[ ... ]] uses stale stat result after command substitution"
+: > "$tmp/stc"
+[[ -f $tmp/stc && -n ${ rm "$tmp/stc"; echo x; } && -e $tmp/stc ]] && err_exit "[[ ... ]] uses stale stat result after shared-state command substitution"
+: > "$tmp/stc"
+[[ -e $tmp/stc ]] && rm "$tmp/stc" && [[ -e $tmp/stc ]] && err_exit "[[ ... ]] uses stale stat result from previous [[ ... ]]"
+: > "$tmp/stc"
+test -e "$tmp/stc" && rm "$tmp/stc" && test -f "$tmp/stc" && err_exit "test uses stale stat result from previous test"
+: > "$tmp/stc"
+function stc_rm { rm "$tmp/stc"; }
+[[ -e $tmp/stc && ! -e $tmp/stc$(stc_rm) ]] || err_exit "[[ ... ]] uses stale stat result after function call"
+[[ ! -e $tmp/stc && ! -r $tmp/stc && ! -f $tmp/stc && ! -s $tmp/stc ]] || err_exit "file tests on nonexistent file"
+: > "$tmp/stc"
+chmod 200 "$tmp/stc"
+[[ -e $tmp/stc && -f $tmp/stc && -w $tmp/stc && ! -s $tmp/stc ]] || err_exit "file tests on existing file"
+[[ $(id -u) != 0 && ( -r $tmp/stc || -x $tmp/stc ) ]] && err_exit "-r or -x on unreadable file after stat"
+unset -f stc_rm
+
 # ======
 exit $((Errors<125?Errors:125))
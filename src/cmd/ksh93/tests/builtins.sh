@@ -2,7 +2,7 @@
 #                                                                      #
 #               This software is part of the ast package               #
 #          Copyright (c) 1982-2012 AT&T Intellectual Property          #
-#          Copyright (c) 2020-2024 Contributors to ksh 93u+m           #
+#          Copyright (c) 2020-2026 Contributors to ksh 93u+m           #
 #                      and is licensed under the                       #
 #                 Eclipse Public License, Version 2.0                  #
 #                                                                      #
@@ -553,6 +553,29 @@ then    for i in $(command command -x ${SHELL:-ksh} -c 'print $#;[[ $1 != argume
 	command -p command -x ${SHELL:-ksh} -c 'print $#;[[ $1 == argument0 ]]' count $(longline $n) > /dev/null  2>&1
 	[[ $? != 1 ]] && err_exit 'incorrect exit status for command -x'
 fi
+# the exit status of command -x must not carry over to later commands
+if	! ${SHELL:-ksh} -c 'print $#' count $(longline $n) > /dev/null  2>&1
+then	command -x ${SHELL:-ksh} -c 'exit 3' count $(longline $n) > /dev/null  2>&1
+	${SHELL:-ksh} -c 'exit 0'
+	got=$?
+	((got == 0)) || err_exit "exit status of command -x carried over to a later command (got $got)"
+fi
+# test command -x -P option
+integer sum=0 n=200000
+if	! ${SHELL:-ksh} -c 'print $#' count $(longline $n) > /dev/null  2>&1
+then	integer npass=0
+	for i in $(command command -x -P 4 ${SHELL:-ksh} -c 'print $#' count $(longline $n) 2> /dev/null)
+	do	((sum += $i, npass++))
+	done
+	(( sum == n )) || err_exit "command -x -P processed $sum arguments instead of $n"
+	(( npass >= 4 )) || err_exit "command -x -P 4 made only $npass invocations"
+	command -x -P 4 ${SHELL:-ksh} -c '[[ $1 != argument0 ]]' count $(longline $n) > /dev/null 2>&1
+	[[ $? != 1 ]] && err_exit 'incorrect exit status for command -x -P'
+fi
+actual=$(command -x -P 0 true 2>&1)
+status=$?
+[[ $status == 2 && $actual == *'invalid number of jobs'* ]] || err_exit 'command -x -P 0 not rejected' \
+	"(got status $status, $(printf %q "$actual"))"
 # test for debug trap
 [[ $(typeset -i i=0
 	trap 'print $i' DEBUG
@@ -1697,5 +1720,88 @@ case $(PATH=/opt/ast/bin:$PATH; exec cat '--???SECTION' </dev/null 2>&1) in
 1)	err_exit "'exec' runs non-external command" ;;
 esac
 
+# ======
+# memstat counts the objects and bytes of the shell's data structures;
+# it is bound to /opt/ast/bin so that it does not shadow an external memstat
+got=$(PATH=/usr/bin:/bin; whence -t memstat)
+[[ $got != builtin ]] || err_exit "memstat is found without /opt/ast/bin in PATH"
+got=$(PATH=/opt/ast/bin:$PATH "$SHELL" -c '
+	typeset -A a
+	memstat arrays | read n c0 b0
+	for ((i=0; i<1000; i++)); do a[key$i]=value$i; done
+	memstat arrays | read n c1 b1
+	function f { memstat locals; }
+	memstat functions | read n c2 b2
+	f | read n c3 b3
+	unset a
+	memstat arrays | read n c4 b4
+	print $((c1 - c0)) $((b1 - b0 > 1000 * 20)) $c2 $((b2 > 0)) $c3 $((b4 < b1))
+' 2>&1)
+exp='1000 1 1 1 0 1'
+[[ $got == "$exp" ]] || err_exit "memstat" \
+	"(expected $(printf %q "$exp"), got $(printf %q "$got"))"
+got=$(/opt/ast/bin/memstat nosuch 2>&1)
+[[ e=$? -eq 2 && $got == *'nosuch: unknown category'* ]] || err_exit "memstat with bad category" \
+	"(got status $e, $(printf %q "$got"))"
+
+# ======
+# filestat sets an array of compound variables with the attributes of files;
+# it is bound to /opt/ast/bin so that it does not shadow an external filestat
+got=$(PATH=/usr/bin:/bin; whence -t filestat)
+[[ $got != builtin ]] || err_exit "filestat is found without /opt/ast/bin in PATH"
+mkdir "$tmp/filestat" && cd "$tmp/filestat" || err_exit "cannot create directory for filestat"
+save_PATH=$PATH
+PATH=/opt/ast/bin:$PATH
+print -n 12345 > 'a file'
+ln -s 'a file' link
+mkdir dir
+chmod 640 'a file'
+TZ=UTC touch -t 200001020304.05 'a file'
+got=$(filestat st 'a file' dir nosuch link 2>&1)
+[[ e=$? -eq 1 && $got == *'nosuch: cannot get file status'* ]] || err_exit "filestat with nonexistent file" \
+	"(got status $e, $(printf %q "$got"))"
+filestat st 'a file' dir nosuch link 2>/dev/null
+got="${#st[@]} ${st[0].name}|${st[0].type} ${st[0].size} ${st[0].mode} ${st[0].perms} ${st[0].nlink}"
+got+=" ${st[1].type} ${st[2].name} ${st[2].size-unset} ${st[3].type} ${st[3].ino-x}"
+exp="4 a file|regular 5 640 -rw-r----- 1 directory nosuch unset regular ${st[0].ino}"
+[[ $got == "$exp" ]] || err_exit "filestat" \
+	"(expected $(printf %q "$exp"), got $(printf %q "$got"))"
+[[ ${st[2].error} ]] || err_exit "filestat does not set error member for nonexistent file"
+[[ ${st[0].uid} == $(id -u) && ${st[0].user} == $(id -un) ]] || err_exit "filestat: wrong owner" \
+	"(got ${st[0].uid} ${st[0].user})"
+[[ ${st[0].mtime} == 946782245.000000000 ]] || err_exit "filestat: wrong mtime" \
+	"(expected 946782245.000000000, got $(printf %q "${st[0].mtime}"))"
+filestat -AP st link 'a file'
+got="${!st[*]} ${st[link].type} ${st[link].target} ${st[a file].type}"
+exp="a file link symlink a file regular"
+[[ $got == "$exp" ]] || err_exit "filestat -AP" \
+	"(expected $(printf %q "$exp"), got $(printf %q "$got"))"
+function f { typeset st; filestat st dir; print -r -- "${st[0].type}"; }
+st=global
+got="$(f) $st"
+[[ $got == 'directory global' ]] || err_exit "filestat does not use local variable" \
+	"(got $(printf %q "$got"))"
+function g { typeset -n r=$1; filestat r dir; print -r -- "${r[0].type}"; }
+function f { typeset arr; g arr; print -r -- "${arr[0].type} ${#arr[@]}"; }
+unset arr
+got="$(f; print -r -- "${arr-unset}")"
+exp=$'directory\ndirectory 1\nunset'
+[[ $got == "$exp" ]] || err_exit "filestat does not follow nameref to local variable" \
+	"(expected $(printf %q "$exp"), got $(printf %q "$got"))"
+got=$(readonly st=1; filestat st dir 2>&1; print "status $? $st")
+[[ $got == *'st: is read only'*'status 1 1' ]] || err_exit "filestat with readonly variable" \
+	"(got $(printf %q "$got"))"
+got=$(filestat -A st '' dir 2>/dev/null; print -r -- "$? ${#st[@]} [${st[''].name}] ${st[''].error:+error} ${st[dir].type}")
+[[ $got == '1 2 [] error directory' ]] || err_exit "filestat -A with empty file name" \
+	"(got $(printf %q "$got"))"
+got=$(filestat 'st[1]' dir 2>&1)
+[[ e=$? -ne 0 && $got == *'cannot be an array'* ]] || err_exit "filestat with array element name" \
+	"(got status $e, $(printf %q "$got"))"
+got=$(filestat st 2>&1)
+[[ e=$? -eq 2 && $got == *'Usage: filestat'* ]] || err_exit "filestat without file operand" \
+	"(got status $e, $(printf %q "$got"))"
+PATH=$save_PATH
+cd "$tmp"
+
 # ======
 exit $((Errors<125?Errors:125))
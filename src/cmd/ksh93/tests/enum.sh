@@ -2,7 +2,7 @@
 #                                                                      #
 #               This software is part of the ast package               #
 #          Copyright (c) 1982-2012 AT&T Intellectual Property          #
-#          Copyright (c) 2020-2024 Contributors to ksh 93u+m           #
+#          Copyright (c) 2020-2026 Contributors to ksh 93u+m           #
 #                      and is licensed under the                       #
 #                 Eclipse Public License, Version 2.0                  #
 #                                                                      #
@@ -214,5 +214,41 @@ got=$(typeset -T foo; typeset -a \[foo] bar 2>&1)
 [[ e=$? -eq 1 && $got == *"$exp" ]] || err_exit 'typeset -a [type] syntax gives bad error message for non-enum type' \
 	"(expected status 1, match of *$(printf %q "$exp"); got status $e, $(printf %q "$got"))"
 
+# ======
+# Values are looked up in a hash table; check that large enums, duplicate
+# values and case-insensitive enums give the same results as a linear search
+got=$(
+	typeset -a many
+	for ((i=0; i<5000; i++))
+	do	many+=("val$i")
+	done
+	enum many
+	many v=val0
+	print -n $((v))
+	v=val4999; print -n " $((v))"
+	v=val2500; print -n " $v $((v))"
+	((v == val2500)) || print -n ' bad arith'
+	(v=val5000) 2>/dev/null && print -n ' bad value'
+	enum dup=(a b a c B)
+	dup d=a; print -n " $((d))"
+	d=B; print -n " $((d))"
+	enum -i idup=(Yes no YES No maybe)
+	idup w=yes; print -n " $w $((w))"
+	w=NO; print -n " $w $((w))"
+	w=MayBe; print " $w $((w))"
+)
+exp='0 4999 val2500 2500 0 4 Yes 0 no 1 maybe 4'
+[[ $got == "$exp" ]] || err_exit 'enum value lookup' \
+	"(expected $(printf %q "$exp"), got $(printf %q "$got"))"
+got=$(
+	typeset -a toomany
+	for ((i=0; i<32768; i++))
+	do	toomany+=($i)
+	done
+	enum toomany 2>&1
+)
+[[ e=$? -eq 1 && $got == *': toomany: more than 32767 enumeration values' ]] || err_exit 'enum with too many values' \
+	"(got status $e, $(printf %q "$got"))"
+
 # ======
 exit $((Errors<125?Errors:125))
@@ -1034,5 +1034,44 @@ let "$? <= 128" || err_exit "crash on huge RLIMIT_NOFILE"
 (ulimit -n 8; "$SHELL" --version) 2>/dev/null
 let "$? <= 128" || err_exit "crash on tiny RLIMIT_NOFILE"
 
+# ======
+# Regular files read sequentially get a read buffer that grows up to ${.sh.readahead} bytes
+[[ ${.sh.readahead} == 1048576 ]] || err_exit "default \${.sh.readahead} is not 1 MiB (got $(printf %q "${.sh.readahead}"))"
+for ((i=0; i<300000; i++)); do print $i; done > readahead.txt
+for exp in 0 65536 1048576; do
+	got=$(.sh.readahead=exp; print ${.sh.readahead})
+	[[ $got == "$exp" ]] || err_exit ".sh.readahead=$exp not honoured (got $(printf %q "$got"))"
+	got=$(
+		.sh.readahead=exp
+		n=0
+		while read -r -u3 line && ((line == n)); do ((n++)); done 3< readahead.txt
+		print $n
+		exec 3< readahead.txt
+		for ((i=0; i<200000; i++)); do read -r -u3 line; done
+		exec 3<#((6))
+		read -r -u3 line
+		print $line
+		exec 3<&-
+	)
+	[[ $got == $'300000
+3' ]] || err_exit "reading with .sh.readahead=$exp fails" \
+		"(expected $'300000\n3', got $(printf %q "$got"))"
+done
+(.sh.readahead=0)
+[[ ${.sh.readahead} == 1048576 ]] || err_exit ".sh.readahead leaks out of a virtual subshell"
+
+# ======
+# Records that straddle the end of the read buffer are reassembled correctly
+got=$(
+	.sh.readahead=0
+	for ((i=1; i<90000; i+=i/2+1)); do printf "%${i}s\n" x; printf '%s\n' "$i"; done > straddle.txt
+	while IFS= read -r line && read -r n; do
+		((${#line} == n)) || { print "line of $n bytes read back as ${#line} bytes"; break; }
+	done < straddle.txt
+	printf 'last%9000s' z >> straddle.txt
+	tail -c 9004 straddle.txt | { read -r line; print ${#line}; }
+)
+[[ $got == 9004 ]] || err_exit "reading long lines across buffer boundaries fails (got $(printf %q "$got"))"
+
 # ======
 exit $((Errors<125?Errors:125))
@@ -2,7 +2,7 @@
 #                                                                      #
 #               This software is part of the ast package               #
 #           Copyright (c) 2019-2020 Contributors to ksh2020            #
-#          Copyright (c) 2022-2024 Contributors to ksh 93u+m           #
+#          Copyright (c) 2022-2026 Contributors to ksh 93u+m           #
 #                      and is licensed under the                       #
 #                 Eclipse Public License, Version 2.0                  #
 #                                                                      #
@@ -722,6 +722,35 @@ if builtin cmp 2> /dev/null; then
 	got=$(cmp -s "$tmp/file1" "$tmp/file2")
 	exp=""
 	[[ $got == "$exp" ]] || err_exit "'cmp -s' should give empty output (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+
+	# differences past the first compared block, with line numbers counted across blocks
+	for ((i=0; i<20000; i++)); do print "line $i"; done > "$tmp/cmpbig1"
+	{ for ((i=0; i<20000; i++)); do ((i==7000)) && print "lime $i" || print "line $i"; done; print extra; } > "$tmp/cmpbig2"
+	got=$(cmp "$tmp/cmpbig1" "$tmp/cmpbig2")
+	exp="$tmp/cmpbig1 $tmp/cmpbig2 differ: char 68893, line 7001"
+	[[ $got == "$exp" ]] || err_exit "'cmp' on large files failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(cmp -l "$tmp/cmpbig1" "$tmp/cmpbig2" 2>&1)
+	exp=$' 68893  156 155\ncmp: EOF on '"$tmp/cmpbig1"
+	[[ $got == "$exp" ]] || err_exit "'cmp -l' on large files failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	# a file truncated during the compare must not kill the shell (as SIGBUS on a mapped page would)
+	cat "$tmp/cmpbig1" "$tmp/cmpbig1" > "$tmp/cmptrunc1"
+	for ((i=0; i<5; i++)); do cat "$tmp/cmptrunc1" "$tmp/cmptrunc1" > "$tmp/cmptrunc2" && mv "$tmp/cmptrunc2" "$tmp/cmptrunc1"; done
+	cp "$tmp/cmptrunc1" "$tmp/cmptrunc2"
+	"$SHELL" -c '
+		builtin cmp || exit 3
+		for ((i=0; i<200; i++)); do cmp "$1" "$2"; done >/dev/null 2>&1
+		exit 0
+	' cmptrunc "$tmp/cmptrunc1" "$tmp/cmptrunc2" &
+	pid=$!
+	for ((i=0; i<10000; i++))
+	do	kill -0 $pid 2>/dev/null || break
+		: > "$tmp/cmptrunc2"
+		cat "$tmp/cmptrunc1" > "$tmp/cmptrunc2"
+	done
+	wait $pid
+	(((e=$?) == 0)) || err_exit "'cmp' on file truncated during compare failed" \
+		"(got status $e$( ((e>128)) && print -n /SIG$(kill -l $e)))"
+	rm -f "$tmp/cmptrunc1" "$tmp/cmptrunc2"
 fi
 
 # ======
@@ -905,5 +934,178 @@ if builtin getconf 2> /dev/null; then
 	[[ $exp == "$got" ]] || err_exit "'getconf -n' doesn't match names correctly" \
 		"(expected $(printf %q "$exp"), got $(printf %q "$got"))"
 fi
+# ======
+# Tests for the uniq builtin
+if builtin uniq 2> /dev/null; then
+	printf '%s\n' b a B b c a > "$tmp/unsorted"
+	printf 'x' >> "$tmp/unsorted"
+
+	#   -H, --hash|unsorted
+	#                   Compare each line with all previous lines.
+	got=$(uniq -H "$tmp/unsorted")
+	exp=$'b\na\nB\nc\nx'
+	[[ $got == "$exp" ]] || err_exit "'uniq -H' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(uniq -Hci "$tmp/unsorted")
+	exp=$'   3 b\n   2 a\n   1 c\n   1 x'
+	[[ $got == "$exp" ]] || err_exit "'uniq -Hci' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(uniq -Hd "$tmp/unsorted")
+	exp=$'b\na'
+	[[ $got == "$exp" ]] || err_exit "'uniq -Hd' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(uniq -Hu "$tmp/unsorted")
+	exp=$'B\nc\nx'
+	[[ $got == "$exp" ]] || err_exit "'uniq -Hu' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(printf '%s\n' '1 b' '2 a' '3 b' | uniq -H -f 1)
+	exp=$'1 b\n2 a'
+	[[ $got == "$exp" ]] || err_exit "'uniq -H -f' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(printf '%s\n' ab1 cd2 ab3 | uniq -H -w 2)
+	exp=$'ab1\ncd2'
+	[[ $got == "$exp" ]] || err_exit "'uniq -H -w' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	exp=10000
+	got=$(( $(for ((i=0; i<30000; i++)); do print $((i%exp)); done | uniq -H | wc -l) ))
+	((got==exp)) || err_exit "'uniq -H' fails to grow its table (expected $exp, got $got)"
+fi
+
+# ======
+# Tests for the sort builtin
+if builtin sort 2> /dev/null; then
+	printf '%s\n' 'x 3 b' 'y 1 a' 'z 2 c' 'w 1 b' 'v 10 a' 'u -2.5 z' > "$tmp/sortin"
+	got=$(sort "$tmp/sortin")
+	exp=$'u -2.5 z\nv 10 a\nw 1 b\nx 3 b\ny 1 a\nz 2 c'
+	[[ $got == "$exp" ]] || err_exit "'sort' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(sort -k2,2n "$tmp/sortin")
+	exp=$'u -2.5 z\nw 1 b\ny 1 a\nz 2 c\nx 3 b\nv 10 a'
+	[[ $got == "$exp" ]] || err_exit "'sort -k2,2n' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(sort -s -k3,3 -k2,2rn "$tmp/sortin")
+	exp=$'v 10 a\ny 1 a\nx 3 b\nw 1 b\nz 2 c\nu -2.5 z'
+	[[ $got == "$exp" ]] || err_exit "'sort -k3,3 -k2,2rn' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(sort -u -k3,3 "$tmp/sortin")
+	exp=$'y 1 a\nx 3 b\nz 2 c\nu -2.5 z'
+	[[ $got == "$exp" ]] || err_exit "'sort -u' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(printf '%s\n' b:2 a:10 c:1 | sort -t: -k2n)
+	exp=$'c:1\nb:2\na:10'
+	[[ $got == "$exp" ]] || err_exit "'sort -t' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	# input larger than the -S memory budget is spilled to temporary files and merged
+	for ((i=0; i<20000; i++)); do print $((i*7919%20000)) $((i%3)); done > "$tmp/sortbig"
+	got=$(sort -S 16Ki -s -k2,2n -k1,1n "$tmp/sortbig" | sort -S 16Ki -c -k2,2n -k1,1n 2>&1) \
+	|| err_exit "'sort -S' output not sorted (got $(printf %q "$got"))"
+	got=$(( $(sort -S 16Ki -u -k2,2 "$tmp/sortbig" | wc -l) ))
+	((got==3)) || err_exit "'sort -S -u' failed (expected 3, got $got)"
+	sort -o "$tmp/sortin" "$tmp/sortin"
+	got=$(<"$tmp/sortin")
+	exp=$'u -2.5 z\nv 10 a\nw 1 b\nx 3 b\ny 1 a\nz 2 c'
+	[[ $got == "$exp" ]] || err_exit "'sort -o' to an input file failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(sort -m "$tmp/sortin" "$tmp/sortin" | sort -C && echo ok)
+	[[ $got == ok ]] || err_exit "'sort -m' failed"
+	printf '%s\n' b a > "$tmp/sortin"
+	sort -C "$tmp/sortin"
+	((got=$?, got==1)) || err_exit "'sort -C' on unsorted input returns status $got"
+fi
+
+# ======
+if builtin tee 2> /dev/null; then
+	# a large input from a pipe or FIFO to files exercises the splice(2) fast path where available
+	for ((i=0; i<50000; i++)); do print "line $i"; done > "$tmp/teein"
+	cat "$tmp/teein" | tee "$tmp/tee1" "$tmp/tee2" > "$tmp/tee3"
+	for f in tee1 tee2 tee3
+	do	cmp -s "$tmp/teein" "$tmp/$f" || err_exit "'tee' output to $f differs from input"
+	done
+	if	mkfifo "$tmp/teefifo" 2> /dev/null
+	then	cat "$tmp/teein" > "$tmp/teefifo" &
+		tee "$tmp/tee1" "$tmp/tee2" < "$tmp/teefifo" > "$tmp/tee3"
+		wait
+		for f in tee1 tee2 tee3
+		do	cmp -s "$tmp/teein" "$tmp/$f" || err_exit "'tee' output to $f from a FIFO differs from input"
+		done
+		# splice(2) refuses a file opened for appending after the first output has taken data
+		print first > "$tmp/tee1"
+		cat "$tmp/teein" > "$tmp/teefifo" &
+		tee -a "$tmp/tee1" < "$tmp/teefifo" > "$tmp/tee3"
+		got=$?
+		wait
+		((got == 0)) || err_exit "'tee -a' from a FIFO returned status $got"
+		cmp -s "$tmp/teein" "$tmp/tee3" || err_exit "'tee -a' standard output from a FIFO differs from input"
+		{ print first; cat "$tmp/teein"; } | cmp -s - "$tmp/tee1" || err_exit "'tee -a' output from a FIFO differs from input"
+	fi
+	print first > "$tmp/tee1"
+	cat "$tmp/teein" | tee -a "$tmp/tee1" | cat > "$tmp/tee3"
+	cmp -s "$tmp/teein" "$tmp/tee3" || err_exit "'tee -a' standard output differs from input"
+	got=$(head -n 2 "$tmp/tee1")
+	exp=$'first\nline 0'
+	[[ $got == "$exp" ]] || err_exit "'tee -a' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+fi
+
+# ======
+if builtin comm 2> /dev/null; then
+	# long runs of common lines are compared a buffer at a time
+	for ((i=0; i<20000; i++)); do print $i; done | sort > "$tmp/comm1"
+	grep -v '^1234$' "$tmp/comm1" > "$tmp/comm2"
+	got=$(comm -3 "$tmp/comm1" "$tmp/comm2")
+	exp=1234
+	[[ $got == "$exp" ]] || err_exit "'comm -3' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(comm -12 "$tmp/comm1" "$tmp/comm2" | wc -l)
+	((got == 19999)) || err_exit "'comm -12' failed (expected 19999 lines, got $got)"
+	got=$(comm "$tmp/comm2" "$tmp/comm1" | grep -c $'^\t\t')
+	((got == 19999)) || err_exit "'comm' failed (expected 19999 common lines, got $got)"
+fi
+
+# ======
+if builtin head 2> /dev/null && builtin tail 2> /dev/null; then
+	# regular files are searched a chunk at a time and copied with sendfile(2) where available
+	for ((i=0; i<50000; i++)); do print "line $i"; done > "$tmp/range"
+	got=$(head -n 40000 "$tmp/range" | tail -n 1)
+	exp='line 39999'
+	[[ $got == "$exp" ]] || err_exit "'head -n' on a large file failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(tail -n 30000 "$tmp/range" | head -n 1)
+	exp='line 20000'
+	[[ $got == "$exp" ]] || err_exit "'tail -n' on a large file failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	{ head -n 2; head -s 3 -n 1; tail -n 1; } < "$tmp/range" > "$tmp/rangeout"
+	print end >> "$tmp/rangeout"
+	got=$(<"$tmp/rangeout")
+	exp=$'line 0\nline 1\nline 5\nline 49999\nend'
+	[[ $got == "$exp" ]] || err_exit "'head' and 'tail' on a shared file offset failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	{ head -n 20000; tail -n 20000; } < "$tmp/range" > "$tmp/rangeout"
+	cmp -s "$tmp/rangeout" <(head -n 20000 "$tmp/range"; tail -n 20000 "$tmp/range") || err_exit "'head' and 'tail' to a file failed"
+fi
+
+# ======
+if builtin find 2> /dev/null; then
+	mkdir -p "$tmp/find/a/b" "$tmp/find/c"
+	: > "$tmp/find/x.c" > "$tmp/find/a/y.c" > "$tmp/find/a/b/z.txt" > "$tmp/find/c/w.C"
+	ln -s ../x.c "$tmp/find/c/link"
+	got=$(cd "$tmp" && find find -name '*.c' | sort)
+	exp=$'find/a/y.c\nfind/x.c'
+	[[ $got == "$exp" ]] || err_exit "'find -name' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(cd "$tmp" && find find -type l -o -iname '*.c' -type f | sort)
+	exp=$'find/a/y.c\nfind/c/link\nfind/c/w.C\nfind/x.c'
+	[[ $got == "$exp" ]] || err_exit "'find -type -o -iname' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(cd "$tmp" && find find -name a -prune -o -type f -print | sort)
+	exp=$'find/c/w.C\nfind/x.c'
+	[[ $got == "$exp" ]] || err_exit "'find -prune' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(cd "$tmp" && find find -mindepth 2 -maxdepth 2 ! -type d | sort)
+	exp=$'find/a/y.c\nfind/c/link\nfind/c/w.C'
+	[[ $got == "$exp" ]] || err_exit "'find -mindepth -maxdepth' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(cd "$tmp" && find find/a -depth | tail -n 1)
+	exp=find/a
+	[[ $got == "$exp" ]] || err_exit "'find -depth' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$(cd "$tmp" && find find/a -name y.c -print0 | od -An -c | tr -s ' ')
+	exp=' f i n d / a / y . c \0'
+	[[ $got == "$exp" ]] || err_exit "'find -print0' failed (expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	# -exec runs shell functions without forking
+	integer n=0
+	function count { (( n += $# )); }
+	find "$tmp/find" -type f -exec count {} +
+	((n == 4)) || err_exit "'find -exec {} +' with a function failed (expected 4, got $n)"
+	n=0
+	find "$tmp/find" -type f -exec count x {} \;
+	((n == 8)) || err_exit "'find -exec ;' with a function failed (expected 8, got $n)"
+	unset -f count
+	find -A found "$tmp/find" -name '*.c'
+	((${#found[@]} == 2)) || err_exit "'find -A' failed (expected 2 elements, got ${#found[@]})"
+	find "$tmp/find" -type f -exec false {} +
+	(($? == 1)) || err_exit "'find -exec {} +' ignores failing commands"
+	got=$(find "$tmp/find" -bogus 2>&1)
+	[[ $got == *'-bogus: unknown primary'* ]] || err_exit "'find' accepts unknown primaries (got $(printf %q "$got"))"
+fi
+
 # ======
 exit $((Errors<125?Errors:125))
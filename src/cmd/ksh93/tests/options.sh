@@ -637,5 +637,58 @@ do
 		"(expected $(printf %q "$exp"), got $(printf %q "$got"))"
 done
 
+# ======
+# set -o profile
+if((SHOPT_PROFILER))
+then	cat >prof.sh <<-'EOF'
+	function f
+	{
+		"${ whence -p true; }"
+	}
+	g() { f; }
+	g
+	(true; exit 3) | true
+	EOF
+	rm -f prof.out
+	KSH_PROFILE=prof.out "$SHELL" prof.sh
+	got=$'\n'$(sed 's|([^ ]*/|(|g' prof.out)$'\n'
+	[[ $got == *$'\nspawns;main (prof.sh:6);g (prof.sh:5);f (prof.sh:3) 1\n'* ]] \
+	|| err_exit 'profile: spawn in function not counted' "(got $(printf %q "$got"))"
+	[[ $got == *$'\nforks;main (prof.sh:7) 1\n'* ]] \
+	|| err_exit 'profile: fork of subshell not counted' "(got $(printf %q "$got"))"
+	[[ $got == *$'\nwall_us;main (prof.sh:6);g (prof.sh:5);f (prof.sh:3) '+([0-9])$'\n'* ]] \
+	|| err_exit 'profile: no time for line in function' "(got $(printf %q "$got"))"
+	got=$(set +x; "$SHELL" -o profile -c 'for i in 1 2; do :; done' 2>&1 >/dev/null)
+	[[ $got == *'wall_us;main (-c:1) '+([0-9])* ]] || err_exit 'profile: -o profile does not write to stderr' \
+		"(got $(printf %q "$got"))"
+fi
+
+# ======
+# set -o jsontrace
+# (the order of the records written by the forked pipeline element is undefined)
+got=$(set +x; KSH_TRACEFD=3 "$SHELL" -c '
+	set -o jsontrace
+	function f { echo "a\"b" >/dev/null; return 3; }
+	f x
+	(exit 4) | "${ whence -p true; }"
+	exit 5' 3>&1 >/dev/null 2>&1 | sed 's/"t":[0-9]*,"dur":[0-9]*,"pid":[0-9]*,//' | sort)
+exp=$'{"sub":0,"line":3,"func":"f","argv":["echo","a\\"b"],"status":0}'
+exp+=$'\n{"sub":0,"line":3,"func":"f","argv":["return","3"],"status":3}'
+exp+=$'\n{"sub":0,"line":4,"func":null,"argv":["f","x"],"status":3}'
+exp+=$'\n{"sub":0,"line":5,"func":null,"argv":["'"${ whence -p true; }"'"],"status":null}'
+exp+=$'\n{"sub":0,"line":6,"func":null,"argv":["exit","5"],"status":5}'
+exp+=$'\n{"sub":1,"line":5,"func":null,"argv":["whence","-p","true"],"status":0}'
+exp+=$'\n{"sub":2,"line":5,"func":null,"argv":["exit","4"],"status":4}'
+[[ $got == "$exp" ]] || err_exit "set -o jsontrace: wrong output" \
+	"(expected $(printf %q "$exp"), got $(printf %q "$got"))"
+
+# bytes that are not valid UTF-8 are escaped; valid UTF-8 is passed through
+got=$(set +x; KSH_TRACEFD=3 LC_ALL=C "$SHELL" -c '
+	set -o jsontrace
+	: $'"'"'\xff\xc3\xa9\xc3\xed\xa0\x80\x7f'"'"'' 3>&1 >/dev/null 2>&1 | sed 's/"t":[0-9]*,"dur":[0-9]*,"pid":[0-9]*,//')
+exp=$'{"sub":0,"line":3,"func":null,"argv":[":","\\u00ff\xc3\xa9\\u00c3\\u00ed\\u00a0\\u0080\\u007f"],"status":0}'
+[[ $got == "$exp" ]] || err_exit "set -o jsontrace: invalid UTF-8 not escaped" \
+	"(expected $(printf %q "$exp"), got $(printf %q "$got"))"
+
 # ======
 exit $((Errors<125?Errors:125))
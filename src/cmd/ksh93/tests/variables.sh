@@ -2,7 +2,7 @@
 #                                                                      #
 #               This software is part of the ast package               #
 #          Copyright (c) 1982-2012 AT&T Intellectual Property          #
-#          Copyright (c) 2020-2024 Contributors to ksh 93u+m           #
+#          Copyright (c) 2020-2026 Contributors to ksh 93u+m           #
 #                      and is licensed under the                       #
 #                 Eclipse Public License, Version 2.0                  #
 #                                                                      #
@@ -1664,5 +1664,71 @@ done
 unset i got bound
 SRANDOM=0
 
+# ======
+# .sh.stats counters, histograms, reset and snapshot
+if	((SHOPT_STATS))
+then	got=$("$SHELL" -c '
+		.sh.stats=
+		print -n abc >/dev/null
+		printf "%s\n" de >/dev/null
+		read x <<-EOF
+		hello
+		EOF
+		x=$(ulimit -t unlimited 2>/dev/null; print ok)
+		"$(whence -p true)"
+		print ${.sh.stats.builtin_calls[print]} ${.sh.stats.builtin_calls[printf]} \
+			${.sh.stats.bytesread} ${.sh.stats.byteswritten} \
+			${.sh.stats.comsub_forks} ${.sh.stats.tmpfiles} \
+			$(( ${.sh.stats.spawn_latency[@]/%/+} 0 )) ${.sh.stats.spawns} \
+			${#.sh.stats.fork_latency[@]}
+		eval "typeset -C snap=$(print -v .sh.stats)"
+		.sh.stats=
+		print ${snap.builtin_calls[printf]} ${.sh.stats.builtin_calls[printf]-unset} ${.sh.stats.byteswritten}
+	' 2>&1)
+	exp=$'1 1 6 6 1 2 1 1 5\n1 unset 0'
+	[[ $got == "$exp" ]] || err_exit ".sh.stats counters" \
+		"(expected $(printf %q "$exp"), got $(printf %q "$got"))"
+	got=$("$SHELL" -c '(.sh.stats=); print ${.sh.stats.simplecmds}' 2>&1)
+	[[ $got == 1 ]] || err_exit "resetting .sh.stats in virtual subshell" \
+		"(expected 1, got $(printf %q "$got"))"
+	# stack frames freed after a command are reused by the next one
+	got=$("$SHELL" -c '
+		big=$(printf "word%d " {1..5000})
+		: $big
+		.sh.stats=
+		for ((i=0; i<100; i++))
+		do	: $big
+		done
+		print $(( ${.sh.stats.stack_peak} > 40000 )) $(( ${.sh.stats.stack_allocs} < 10 ))
+	' 2>&1)
+	[[ $got == '1 1' ]] || err_exit "stack frames not reused" \
+		"(expected '1 1', got $(printf %q "$got"))"
+	# variable nodes come from slabs and are counted per size class
+	got=$("$SHELL" -c '
+		integer n0=0 n1=0 n2=0
+		for i in "${.sh.stats.nv_nodes[@]}"; do ((n0 += i)); done
+		typeset -A a
+		for ((i=0; i<1000; i++)); do a[element$i]=$i; done
+		for i in "${.sh.stats.nv_nodes[@]}"; do ((n1 += i)); done
+		unset a
+		for i in "${.sh.stats.nv_nodes[@]}"; do ((n2 += i)); done
+		print $((n1 - n0 >= 1000)) $((n1 - n2 >= 990))
+	' 2>&1)
+	[[ $got == '1 1' ]] || err_exit ".sh.stats.nv_nodes" \
+		"(expected '1 1', got $(printf %q "$got"))"
+	# file test operators in one expression share one stat(2) of a file
+	got=$("$SHELL" -c '
+		.sh.stats=
+		[[ -e $0 && -f $0 && -s $0 && ! -d $0 ]]
+		print $? ${.sh.stats.file_stats} ${.sh.stats.file_cachehits}
+		.sh.stats=
+		test -e /dev/null/x -o -r /dev/null/x -o -f /dev/null/x
+		print $? ${.sh.stats.file_stats} ${.sh.stats.file_cachehits}
+	' "$SHELL" 2>&1)
+	exp=$'0 1 3\n1 1 2'
+	[[ $got == "$exp" ]] || err_exit ".sh.stats.file_stats and file_cachehits" \
+		"(expected $(printf %q "$exp"), got $(printf %q "$got"))"
+fi
+
 # ======
 exit $((Errors<125?Errors:125))
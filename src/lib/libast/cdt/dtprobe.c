@@ -0,0 +1,506 @@
+/***********************************************************************
+*                                                                      *
+*               This software is part of the ast package               *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
+*                      and is licensed under the                       *
+*                 Eclipse Public License, Version 2.0                  *
+*                                                                      *
+*                A copy of the License is available at                 *
+*      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      *
+*         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         *
+*                                                                      *
+*                  Martijn Dekker <martijn@inlv.org>                   *
+*                                                                      *
+***********************************************************************/
+#include	"dthdr.h"
+
+/*	Hash table with open addressing.
+**
+**	The objects are kept in an array of slots, not in collision chains.
+**	Each slot also has a one-byte tag: P_EMPTY, P_DELETED, or seven bits
+**	of the hash value of its object. The slots are divided into groups of
+**	P_SLOTS, each with its tags in front of its slots, and a search
+**	compares the tags of a whole group at once, then compares keys only
+**	in the slots whose tags match. A search ends at the first group with
+**	an empty slot. The groups are probed quadratically. On 64-bit systems
+**	a group is two cache lines that are aligned to be fetched together,
+**	so most searches cost one memory access for the group and one for
+**	the object found.
+*/
+
+#if defined(__SSE2__)
+#include	<emmintrin.h>
+#endif
+
+#define P_GROUP		16	/* tags compared at once		*/
+#define P_SLOTS		14	/* slots in a group			*/
+#define P_ALL		((1<<P_SLOTS)-1)
+#define P_ALIGN		128	/* alignment of groups			*/
+#define P_EMPTY		0x80	/* tag of an unused slot		*/
+#define P_DELETED	0xfe	/* tag of a slot of a deleted object	*/
+
+#define PLOAD(n)	((n)/P_GROUP*P_SLOTS*3/4) /* usable slots	*/
+
+/* the high half of a 64-bit product depends on all bits of the hash value */
+#define PMIX(h)		((uint)(((uint64_t)(h)*0x9e3779b97f4a7c15)>>32))
+#define PTAG(m)		((int)((m)&0x7f))
+#define PSTART(p,m)	(((m)>>3)&((p)->tblz-1)&~(P_GROUP-1))
+#define PPROBE(p,g,i)	(((g)+(i)*P_GROUP)&((p)->tblz-1))
+
+/* the tags of the group starting at slot g; the tag and object of slot s.
+** Slot numbers are those of the tags, so P_GROUP-P_SLOTS of every P_GROUP
+** are never used and their tags are always P_EMPTY.
+*/
+#define PTAGS(p,g)	((p)->grp[(g)/P_GROUP].tags)
+#define TAG(p,s)	((p)->grp[(s)/P_GROUP].tags[(s)%P_GROUP])
+#define SLOT(p,s)	((p)->grp[(s)/P_GROUP].slot[(s)%P_GROUP])
+
+typedef struct _dtgroup_s
+{	uchar		tags[P_GROUP];
+	Dtlink_t*	slot[P_SLOTS];
+} Dtgroup_t;
+
+/* internal data structure for hash table with open addressing */
+typedef struct _dtprobe_s
+{	Dtdata_t	data;
+	ssize_t		here;	/* slot of fingered object, or -1	*/
+	Dtgroup_t*	grp;	/* the slots				*/
+	void*		mem;	/* memory holding grp			*/
+	ssize_t		tblz;	/* number of slots, a power of 2	*/
+	ssize_t		used;	/* slots that are not P_EMPTY		*/
+} Dtprobe_t;
+
+/* bit i is set if tag i of group g is c (PMATCH) or has no object (PFREE) */
+#if defined(__SSE2__)
+#define PMATCH(g,c)	((uint)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)(g)),_mm_set1_epi8((char)(c))))&P_ALL)
+#define PFREE(g)	((uint)_mm_movemask_epi8(_mm_loadu_si128((__m128i*)(g)))&P_ALL)
+#else
+static uint PMATCH(uchar* g, int c)
+{
+	uint	bits = 0;
+	int	i;
+
+	for(i = 0; i < P_SLOTS; ++i)
+		if(g[i] == c)
+			bits |= 1<<i;
+	return bits;
+}
+static uint PFREE(uchar* g)
+{
+	uint	bits = 0;
+	int	i;
+
+	for(i = 0; i < P_SLOTS; ++i)
+		if(g[i] & 0x80)
+			bits |= 1<<i;
+	return bits;
+}
+#endif
+
+/* index of the lowest bit set */
+#if __GNUC__
+#define PFIRST(bits)	__builtin_ctz(bits)
+#else
+static int PFIRST(uint bits)
+{
+	int	i;
+
+	for(i = 0; !(bits&1); ++i)
+		bits >>= 1;
+	return i;
+}
+#endif
+
+/* first free slot in the probe sequence of mixed hash value m */
+static ssize_t pfree(Dtprobe_t* prob, uint m)
+{
+	ssize_t	g, i;
+	uint	bits;
+
+	for(g = PSTART(prob,m), i = 1; !(bits = PFREE(PTAGS(prob,g))); ++i)
+		g = PPROBE(prob,g,i);
+	return g + PFIRST(bits);
+}
+
+/* make/resize table so that it holds one more object than it does now */
+static int ptable(Dt_t* dt)
+{
+	Dtgroup_t	*grp, *ogrp;
+	Dtlink_t	*l;
+	void		*mem;
+	ssize_t		n, k, s;
+	uint		m;
+	Dtdisc_t	*disc = dt->disc;
+	Dtprobe_t	*prob = (Dtprobe_t*)dt->data;
+
+	n = 0;
+	if(!prob->grp && disc && disc->eventf) /* let user have input */
+	{	if((*disc->eventf)(dt, DT_HASHSIZE, &n, disc) > 0 && n < 0)
+			n = -n; /* an open table cannot have a fixed size */
+	}
+
+	/* table size is a power of 2 and after resizing at most 3/4 of PLOAD is used */
+	k = P_GROUP;
+	while(k < n || PLOAD(k)/4*3 <= prob->data.size)
+		k *= 2;
+
+	if(!(mem = (*dt->memoryf)(dt, 0, k/P_GROUP*sizeof(Dtgroup_t)+P_ALIGN, disc)) )
+	{	DTERROR(dt, "Error in allocating an extended hash table");
+		return -1;
+	}
+	grp = (Dtgroup_t*)((char*)mem + (-(uintptr_t)mem & (P_ALIGN-1)));
+	for(s = 0; s < k/P_GROUP; ++s)
+		memset(grp[s].tags, P_EMPTY, P_GROUP);
+
+	/* move objects into new table */
+	ogrp = prob->grp;
+	n = prob->tblz;
+	prob->grp = grp;
+	prob->tblz = k;
+	for(k = 0; k < n; ++k)
+	{	if(ogrp[k/P_GROUP].tags[k%P_GROUP] & 0x80)
+			continue;
+		l = ogrp[k/P_GROUP].slot[k%P_GROUP];
+		m = PMIX(l->_hash);
+		s = pfree(prob, m);
+		TAG(prob,s) = PTAG(m);
+		SLOT(prob,s) = l;
+	}
+
+	if(prob->mem) /* free old table */
+		(void)(*dt->memoryf)(dt, prob->mem, 0, disc);
+	prob->mem = mem;
+	prob->used = prob->data.size;
+	prob->here = -1;
+
+	return 0;
+}
+
+/* find the slot of an object matching key with hash value hsh, or -1.
+** For DT_REMOVE, this is the slot of obj itself. For DT_NEXT|DT_PREV,
+** it is that slot if obj is in the table, else that of any match.
+*/
+static ssize_t pfind(Dt_t* dt, void* key, uint hsh, void* obj, int type)
+{
+	Dtlink_t	*l;
+	void		*o;
+	ssize_t		g, i, s, ll;
+	uint		bits, m = PMIX(hsh);
+	int		tag = PTAG(m);
+	Dtdisc_t	*disc = dt->disc;
+	Dtprobe_t	*prob = (Dtprobe_t*)dt->data;
+
+	ll = -1;
+	for(g = PSTART(prob,m), i = 1; ; g = PPROBE(prob,g,i), ++i)
+	{	for(bits = PMATCH(PTAGS(prob,g), tag); bits; bits &= bits-1)
+		{	s = g + PFIRST(bits);
+			if((l = SLOT(prob,s))->_hash != hsh)
+				continue;
+			o = _DTOBJ(disc,l);
+			if(_DTCMP(dt, key, _DTKEY(disc,o), disc) != 0 )
+				continue;
+			else if((type&(DT_REMOVE|DT_NEXT|DT_PREV)) && o != obj )
+			{	if(type&(DT_NEXT|DT_PREV) )
+					ll = s;
+				continue;
+			}
+			else	return s;
+		}
+		if(PMATCH(PTAGS(prob,g), P_EMPTY))
+			return ll;
+	}
+}
+
+/* the first object in slot s or after it */
+static void* pscan(Dt_t* dt, ssize_t s)
+{
+	ssize_t		g;
+	uint		bits;
+	Dtprobe_t	*prob = (Dtprobe_t*)dt->data;
+
+	for(g = s & ~(P_GROUP-1); g < prob->tblz; g += P_GROUP)
+	{	bits = ~PFREE(PTAGS(prob,g)) & P_ALL;
+		if(g < s)
+			bits &= ~0u << (s-g);
+		if(bits)
+		{	prob->here = g + PFIRST(bits);
+			return _DTOBJ(dt->disc, SLOT(prob,prob->here));
+		}
+	}
+	return NULL;
+}
+
+/* empty slot s; it stays a P_DELETED tombstone if a search may pass it */
+static void pdelete(Dtprobe_t* prob, ssize_t s)
+{
+	prob->data.size -= 1;
+	if(PMATCH(PTAGS(prob,s), P_EMPTY))
+	{	TAG(prob,s) = P_EMPTY;
+		prob->used -= 1;
+	}
+	else	TAG(prob,s) = P_DELETED;
+}
+
+/* mark all slots P_EMPTY */
+static void pempty(Dtprobe_t* prob)
+{
+	ssize_t		g;
+
+	for(g = 0; g < prob->tblz; g += P_GROUP)
+		memset(PTAGS(prob,g), P_EMPTY, P_GROUP);
+	prob->here = -1;
+	prob->data.size = 0;
+	prob->used = 0;
+}
+
+static void* pclear(Dt_t* dt)
+{
+	ssize_t		s;
+	Dtprobe_t	*prob = (Dtprobe_t*)dt->data;
+
+	for(s = 0; s < prob->tblz; ++s)
+		if(!(TAG(prob,s) & 0x80))
+			_dtfree(dt, SLOT(prob,s), DT_DELETE);
+	pempty(prob);
+
+	return NULL;
+}
+
+static void* plist(Dt_t* dt, Dtlink_t* list, int type)
+{
+	void		*obj;
+	Dtlink_t	*l, *next, *head, *tail;
+	ssize_t		s;
+	Dtdisc_t	*disc = dt->disc;
+	Dtprobe_t	*prob = (Dtprobe_t*)dt->data;
+
+	if(type&(DT_FLATTEN|DT_EXTRACT))
+	{	/* the table does not use _rght, so it needs no restoring */
+		head = tail = NULL;
+		for(s = 0; s < prob->tblz; ++s)
+		{	if(TAG(prob,s) & 0x80)
+				continue;
+			l = SLOT(prob,s);
+			if(tail)
+				tail = (tail->_rght = l);
+			else	head = tail = l;
+		}
+		if(tail)
+			tail->_rght = NULL;
+		if(type&DT_EXTRACT)
+			pempty(prob);
+		return head;
+	}
+	else /* if(type&DT_RESTORE) */
+	{	dt->data->size = 0;
+		for(l = list; l; l = next)
+		{	next = l->_rght;
+			obj = _DTOBJ(disc,l);
+			if((*dt->meth->searchf)(dt, l, DT_RELINK) == obj)
+				dt->data->size += 1;
+		}
+		return list;
+	}
+}
+
+static void* pstat(Dt_t* dt, Dtstat_t* st)
+{
+	ssize_t		g, n, s;
+	uint		m;
+	Dtprobe_t	*prob = (Dtprobe_t*)dt->data;
+
+	if(st)
+	{	memset(st, 0, sizeof(Dtstat_t));
+		st->meth  = dt->meth->type;
+		st->size  = prob->data.size;
+		st->space = sizeof(Dtprobe_t) + prob->tblz/P_GROUP*sizeof(Dtgroup_t)+P_ALIGN +
+			    (dt->disc->link >= 0 ? 0 : prob->data.size*sizeof(Dthold_t));
+
+		/* lsize[n] counts the objects found in the n-th group probed */
+		for(s = 0; s < prob->tblz; ++s)
+		{	if(TAG(prob,s) & 0x80)
+				continue;
+			m = PMIX(SLOT(prob,s)->_hash);
+			for(g = PSTART(prob,m), n = 0; g != (s & ~(P_GROUP-1)); )
+				g = PPROBE(prob,g,++n);
+			if(n < DT_MAXSIZE)
+			{	st->lsize[n] += 1;
+				st->msize = n+1 > st->msize ? n+1 : st->msize;
+			}
+			st->mlev = n+1 > st->mlev ? n+1 : st->mlev;
+		}
+	}
+
+	return (void*)prob->data.size;
+}
+
+static void* dtprobe(Dt_t* dt, void* obj, int type)
+{
+	Dtlink_t	*lnk;
+	void		*key, *o;
+	ssize_t		s;
+	uint		hsh, m;
+	Dtdisc_t	*disc = dt->disc;
+	Dtprobe_t	*prob = (Dtprobe_t*)dt->data;
+
+	type = DTTYPE(dt,type); /* map type for upward compatibility */
+	if(!(type&DT_OPERATIONS) )
+		return NULL;
+
+	DTSETLOCK(dt);
+
+	if(!prob->grp && ptable(dt) < 0 ) /* initialize hash table */
+		DTRETURN(obj, NULL);
+
+	if(type&(DT_FIRST|DT_LAST|DT_CLEAR|DT_EXTRACT|DT_RESTORE|DT_FLATTEN|DT_STAT) )
+	{	if(type&(DT_FIRST|DT_LAST) )
+			DTRETURN(obj, pscan(dt, 0));
+		else if(type&DT_CLEAR)
+			DTRETURN(obj, pclear(dt));
+		else if(type&DT_STAT)
+			DTRETURN(obj, pstat(dt, (Dtstat_t*)obj));
+		else /*if(type&(DT_EXTRACT|DT_RESTORE|DT_FLATTEN))*/
+			DTRETURN(obj, plist(dt, (Dtlink_t*)obj, type));
+	}
+
+	s = prob->here; /* fingered object */
+	prob->here = -1;
+
+	if(s >= 0 && !(TAG(prob,s) & 0x80) && obj == _DTOBJ(disc,SLOT(prob,s)))
+	{	if(type&DT_SEARCH)
+			DTRETURN(obj, obj);
+		else if(type&(DT_NEXT|DT_PREV) )
+			DTRETURN(obj, pscan(dt, s+1));
+	}
+
+	if(type&DT_RELINK)
+	{	lnk = (Dtlink_t*)obj;
+		obj = _DTOBJ(disc,lnk);
+		key = _DTKEY(disc,obj);
+	}
+	else
+	{	lnk = NULL;
+		if((type&DT_MATCH) )
+		{	key = obj;
+			obj = NULL;
+		}
+		else	key = _DTKEY(disc,obj);
+	}
+	hsh = _DTHSH(dt,key,disc);
+
+	if((s = pfind(dt, key, hsh, obj, type)) >= 0) /* found object */
+	{	if(type&(DT_SEARCH|DT_MATCH|DT_ATLEAST|DT_ATMOST) )
+		{	prob->here = s;
+			DTRETURN(obj, _DTOBJ(disc,SLOT(prob,s)));
+		}
+		else if(type & (DT_NEXT|DT_PREV) )
+			DTRETURN(obj, pscan(dt, s+1));
+		else if(type & (DT_DELETE|DT_DETACH|DT_REMOVE) )
+		{	lnk = SLOT(prob,s);
+			pdelete(prob, s);
+			_dtfree(dt, lnk, type);
+			DTRETURN(obj, _DTOBJ(disc,lnk));
+		}
+		else if(type & DT_INSTALL )
+		{	if(dt->meth->type&DT_BAG)
+				goto do_insert;
+			else if(!(lnk = _dtmake(dt, obj, type)) )
+				DTRETURN(obj, NULL );
+			else /* replace old object with new one in its slot */
+			{	o = _DTOBJ(disc,SLOT(prob,s));
+				_dtfree(dt, SLOT(prob,s), DT_DELETE);
+				DTANNOUNCE(dt, o, DT_DELETE);
+				lnk->_hash = hsh;
+				SLOT(prob,s) = lnk;
+				prob->here = s;
+				DTRETURN(obj, _DTOBJ(disc,lnk));
+			}
+		}
+		else
+		{	/**/DEBUG_ASSERT(type&(DT_INSERT|DT_ATTACH|DT_APPEND|DT_RELINK));
+			if((dt->meth->type&DT_BAG) )
+				goto do_insert;
+			else
+			{	if(type&(DT_INSERT|DT_APPEND|DT_ATTACH) )
+					type |= DT_MATCH; /* for announcement */
+				else if(lnk && (type&DT_RELINK) )
+				{	/* remove a duplicate */
+					o = _DTOBJ(disc, lnk);
+					_dtfree(dt, lnk, DT_DELETE);
+					DTANNOUNCE(dt, o, DT_DELETE);
+				}
+				DTRETURN(obj, _DTOBJ(disc,SLOT(prob,s)));
+			}
+		}
+	}
+	else /* no matching object */
+	{	if(!(type&(DT_INSERT|DT_INSTALL|DT_APPEND|DT_ATTACH|DT_RELINK)) )
+			DTRETURN(obj, NULL);
+
+	do_insert: /* inserting a new object */
+		if(prob->used >= PLOAD(prob->tblz) && ptable(dt) < 0 )
+			DTRETURN(obj, NULL);
+
+		if(!lnk) /* inserting a new object */
+		{	if(!(lnk = _dtmake(dt, obj, type)) )
+				DTRETURN(obj, NULL);
+			prob->data.size += 1;
+		}
+
+		lnk->_hash = hsh; /* memoize the hash value */
+		m = PMIX(hsh);
+		s = pfree(prob, m);
+		if(TAG(prob,s) == P_EMPTY)
+			prob->used += 1;
+		TAG(prob,s) = PTAG(m);
+		SLOT(prob,s) = lnk;
+
+		prob->here = s;
+		DTRETURN(obj, _DTOBJ(disc,lnk));
+	}
+
+dt_return:
+	DTANNOUNCE(dt, obj, type);
+	DTCLRLOCK(dt);
+	return obj;
+}
+
+static int probeevent(Dt_t* dt, int event, void* arg)
+{
+	Dtprobe_t	*prob = (Dtprobe_t*)dt->data;
+
+	NOT_USED(arg);
+	if(event == DT_OPEN)
+	{	if(prob)
+			return 0;
+		if(!(prob = (Dtprobe_t*)(*dt->memoryf)(dt, 0, sizeof(Dtprobe_t), dt->disc)) )
+		{	DTERROR(dt, "Error in allocating a hash table with open addressing");
+			return -1;
+		}
+		memset(prob, 0, sizeof(Dtprobe_t));
+		prob->here = -1;
+		dt->data = (Dtdata_t*)prob;
+		return 1;
+	}
+	else if(event == DT_CLOSE)
+	{	if(!prob)
+			return 0;
+		if(prob->data.size > 0 )
+			(void)pclear(dt);
+		if(prob->mem)
+			(void)(*dt->memoryf)(dt, prob->mem, 0, dt->disc);
+		(void)(*dt->memoryf)(dt, prob, 0, dt->disc);
+		dt->data = NULL;
+		return 0;
+	}
+	else	return 0;
+}
+
+static Dtmethod_t	_Dtpset = { dtprobe, DT_SET, probeevent, "Dtpset" };
+static Dtmethod_t	_Dtpbag = { dtprobe, DT_BAG, probeevent, "Dtpbag" };
+Dtmethod_t		*Dtpset = &_Dtpset;
+Dtmethod_t		*Dtpbag = &_Dtpbag;
+
+#ifdef NoF
+NoF(dtprobe)
+#endif
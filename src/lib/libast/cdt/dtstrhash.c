@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1985-2011 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2022 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -19,31 +19,95 @@
 #include	"dthdr.h"
 
 /* Hashing a string into an unsigned integer.
-** This is the FNV (Fowler-Noll-Vo) hash function.
-** Written by Kiem-Phong Vo (01/10/2012)
+** The bytes are read eight at a time and mixed by 64x64->128-bit
+** multiplication, after the wyhash function by Wang Yi; a string of
+** up to 16 bytes takes two multiplications plus one for a nonzero seed.
+** A string of fewer than eight bytes, such as most command names, is
+** packed into one word a byte at a time while looking for its end, so
+** it needs neither strlen() nor more than one multiplication.
+** Originally this was FNV, one multiplication per byte.
 */
 
-uint dtstrhash(uint h, void* args, ssize_t n)
+#define H_P0	0xa0761d6478bd642fULL
+#define H_P1	0xe7037ed1a0b428dbULL
+#define H_P2	0x8ebc6af09c88c6dbULL
+#define H_S0	0x1ff5c2923a788d2cULL	/* hmix(H_P0,H_P1), the seed for h == 0 */
+
+/* multiply a by b and fold the 128-bit product into 64 bits */
+static uint64_t hmix(uint64_t a, uint64_t b)
 {
-	unsigned char	*s = (unsigned char*)args;
-
-#if _ast_sizeof_int == 8 /* 64-bit hash */
-#define	FNV_PRIME	((1<<40) + (1<<8) + 0xb3)
-#define FNV_OFFSET	14695981039346656037
-#else /* 32-bit hash */
-#define	FNV_PRIME	((1<<24) + (1<<8) + 0x93)
-#define FNV_OFFSET	2166136261
+#if __SIZEOF_INT128__
+	__uint128_t	r = (__uint128_t)a * b;
+
+	return (uint64_t)r ^ (uint64_t)(r >> 64);
+#else
+	uint64_t	ha = a >> 32, la = (uint32_t)a, hb = b >> 32, lb = (uint32_t)b;
+	uint64_t	rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+	uint64_t	t = rl + (rm0 << 32), c = t < rl, lo, hi;
+
+	lo = t + (rm1 << 32);
+	c += lo < t;
+	hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+	return lo ^ hi;
 #endif
-	h = (h == 0 || h == ~0) ? FNV_OFFSET : h;
+}
+
+static uint64_t hread8(const uchar* s)
+{
+	uint64_t	v;
+
+	memcpy(&v, s, sizeof(v));
+	return v;
+}
+
+static uint64_t hread4(const uchar* s)
+{
+	uint32_t	v;
+
+	memcpy(&v, s, sizeof(v));
+	return v;
+}
+
+uint dtstrhash(uint h, void* args, ssize_t n)
+{
+	const uchar	*s = (const uchar*)args;
+	uint64_t	seed, a, b;
+	size_t		k;
+	uint		c;
+
 	if(n <= 0) /* see discipline key definition for == 0 */
-	{	for(; *s != 0; ++s )
-			h = (h ^ s[0]) * FNV_PRIME;
+	{	for(a = 0, k = 0; k < 8; ++k)
+		{	if(!(c = s[k]))
+				goto word;
+			a |= (uint64_t)c << (k << 3);
+		}
+		n = k + strlen((char*)s + k);
+	}
+	else if(n < 8)
+	{	for(a = 0, k = 0; k < n; ++k)
+			a |= (uint64_t)s[k] << (k << 3);
+	word:	seed = h ? hmix((uint64_t)h ^ H_P0, H_P1) : H_S0;
+		seed = hmix(a ^ H_P1, seed ^ H_P2 ^ (uint64_t)k);
+		goto done;
+	}
+	seed = h ? hmix((uint64_t)h ^ H_P0, H_P1) : H_S0;
+	if(n <= 16)
+	{	k = (n >> 3) << 2; /* 4 or 8: the two words overlap if n < 16 */
+		a = (hread4(s) << 32) | hread4(s + k);
+		b = (hread4(s + n - 4) << 32) | hread4(s + n - 4 - k);
 	}
 	else
-	{	unsigned char*	ends;
-		for(ends = s+n; s < ends; ++s)
-			h = (h ^ s[0]) * FNV_PRIME;
+	{	for(k = n; k > 16; k -= 16, s += 16)
+			seed = hmix(hread8(s) ^ H_P1, hread8(s + 8) ^ seed);
+		a = hread8(s + k - 16);
+		b = hread8(s + k - 8);
 	}
-
-	return h;
+	seed = hmix(a ^ H_P1, b ^ seed);
+	seed = hmix(seed ^ H_P0 ^ (uint64_t)n, seed ^ H_P2);
+done:
+#if _ast_sizeof_int == 8
+	return (uint)seed;
+#else
+	return (uint)(seed ^ (seed >> 32));
+#endif
 }
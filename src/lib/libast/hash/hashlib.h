@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1985-2011 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2023 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -27,6 +27,7 @@
 #define _HASHLIB_H
 
 #include <ast.h>
+#include <cdt.h>
 
 #define hash_info	_hash_info_
 
@@ -78,17 +79,7 @@ typedef struct				/* root local pointers		*/
 #define HASHVAL(x)	((x)&~HASH_FLAGS)
 
 #define HASH(r,n,h)	if (r->local->hash) h = r->namesize ? (*r->local->hash)(n, r->namesize) : (*r->local->hash)(n);\
-			else\
-			{\
-				const char*	_hash_s1 = n;\
-				h = 0;\
-				if (r->namesize)\
-				{\
-					const char*	_hash_s2 = _hash_s1 + r->namesize;\
-					while (_hash_s1 < _hash_s2) HASHPART(h, *_hash_s1++);\
-				}\
-				else while (*_hash_s1) HASHPART(h, *_hash_s1++);\
-			}
+			else h = r->namesize ? memhash(n, r->namesize) : strhash(n)
 
 typedef struct				/* library private info		*/
 {
@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1985-2011 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2024 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -46,12 +46,7 @@ hashlook(Hash_table_t* tab, const char* name, long flags, const char* value)
 		int		c;
 
 		if (flags & HASH_HASHED) n = *((unsigned int*)value);
-		else
-		{
-			s2 = name;
-			n = 0;
-			while (c = *s2++) HASHPART(n, c);
-		}
+		else n = strhash(name);
 		i = n;
 		for (;;)
 		{
@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1985-2011 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2023 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -32,10 +32,5 @@
 unsigned int
 memhash(const void* as, int n)
 {
-	const unsigned char*	s = (const unsigned char*)as;
-	const unsigned char*	e = s + n;
-	unsigned int		c = 0;
-
-	while (s < e) HASHPART(c, *s++);
-	return c;
+	return dtstrhash(0, n > 0 ? (void*)as : (void*)"", n > 0 ? n : -1);
 }
@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1985-2011 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2023 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -33,10 +33,5 @@
 unsigned int
 strhash(const char* as)
 {
-	const unsigned char*	s = (const unsigned char*)as;
-	unsigned int		i = 0;
-	unsigned int		c;
-
-	while (c = *s++) HASHPART(i, c);
-	return i;
+	return dtstrhash(0, (void*)as, -1);
 }
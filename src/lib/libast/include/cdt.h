@@ -227,6 +227,8 @@ struct _dtstat_s
 
 extern Dtmethod_t* 	Dtset;
 extern Dtmethod_t* 	Dtbag;
+extern Dtmethod_t* 	Dtpset;
+extern Dtmethod_t* 	Dtpbag;
 extern Dtmethod_t* 	Dtoset;
 extern Dtmethod_t* 	Dtobag;
 extern Dtmethod_t*	Dtlist;
@@ -36,6 +36,7 @@
  * fts_open flags
  */
 
+#define FTS_DTYPE	(1<<12)	/* FTS_NSOK st_mode type from readdir()	*/
 #define FTS_LOGICAL	0	/* logical traversal, follow symlinks	*/
 #define FTS_META	(1<<0)	/* follow top dir symlinks even if phys	*/
 #define FTS_NOCHDIR	(1<<1)	/* don't chdir				*/
@@ -50,7 +51,7 @@
 #define FTS_TOP		(1<<8)	/* don't traverse subdirectories	*/
 #define FTS_XDEV	(1<<9)	/* don't cross mount points		*/
 
-#define FTS_USER	(1<<12)	/* first user flag bit			*/
+#define FTS_USER	(1<<13)	/* first user flag bit			*/
 
 #define FTS_COMFOLLOW	FTS_META
 
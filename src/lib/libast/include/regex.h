@@ -227,6 +227,8 @@ extern int	regrexec(const regex_t*, const char*, size_t, size_t, regmatch_t*, re
 extern regstat_t* regstat(const regex_t*);
 
 extern regex_t*	regcache(const char*, regflags_t, int*);
+extern unsigned long	regcachecomps(void);
+extern unsigned long	regcachesize(size_t*);
 
 extern int	regsubcomp(regex_t*, const char*, const regflags_t*, int, regflags_t);
 extern int	regsubexec(const regex_t*, const char*, size_t, regmatch_t*);
@@ -171,9 +171,11 @@ struct _sffmt_s
 
 #define SFIO_BUFSIZE	8192	/* default buffer size			*/
 #define SFIO_UNBOUND	(-1)	/* unbounded buffer size		*/
+#define SFIO_MAXBUF	(1024*1024)	/* default cap on read buffer growth	*/
 
 extern ssize_t		_Sfi;
 extern ssize_t		_Sfmaxr;
+extern ssize_t		_Sfmaxbuf;
 
 /* standard in/out/err streams */
 extern Sfio_t*		sfstdin;
@@ -269,6 +271,7 @@ extern int		sferror(Sfio_t*);
 extern int		sffileno(Sfio_t*);
 extern int		sfstacked(Sfio_t*);
 extern ssize_t		sfvalue(Sfio_t*);
+extern size_t		sfstraddle(Sfio_t*);
 extern ssize_t		sfslen(void);
 extern ssize_t		sfmaxr(ssize_t, int);
 
@@ -310,6 +313,7 @@ extern ssize_t		sfmaxr(ssize_t, int);
 #define __sf_value(f)	(_SFIO_(f)->_val)
 #define __sf_slen()	(_Sfi)
 #define __sf_maxr(n,s)	((s)?((_Sfi=_Sfmaxr),(_Sfmaxr=(n)),_Sfi):_Sfmaxr)
+#define __sf_maxbuf(n,s)	((s)?((_Sfi=_Sfmaxbuf),(_Sfmaxbuf=(n)),_Sfi):_Sfmaxbuf)
 
 #if defined(__INLINE__) && !_BLD_sfio
 
@@ -334,6 +338,7 @@ __INLINE__ int sfstacked(Sfio_t* f)		{ return __sf_stacked(f); }
 __INLINE__ ssize_t sfvalue(Sfio_t* f)		{ return __sf_value(f); }
 __INLINE__ ssize_t sfslen()			{ return __sf_slen(); }
 __INLINE__ ssize_t sfmaxr(ssize_t n, int s)	{ return __sf_maxr(n,s); }
+__INLINE__ ssize_t sfmaxbuf(ssize_t n, int s)	{ return __sf_maxbuf(n,s); }
 
 #else
 
@@ -357,6 +362,7 @@ __INLINE__ ssize_t sfmaxr(ssize_t n, int s)	{ return __sf_maxr(n,s); }
 #define sfvalue(f)				( __sf_value(f) )
 #define sfslen()				( __sf_slen() )
 #define sfmaxr(n,s)				( __sf_maxr(n,s) )
+#define sfmaxbuf(n,s)				( __sf_maxbuf(n,s) )
 
 #endif /*__INLINE__*/
 
@@ -44,6 +44,7 @@
 	Sfoff_t			lpos;	/* last seek position		*/ \
 	size_t			iosz;	/* preferred size for I/O	*/ \
 	size_t			blksz;	/* preferred block size		*/ \
+	size_t			straddle; /* sfgetr records split by buffer	*/ \
 	int			getr;	/* the last sfgetr separator 	*/ \
 	_SFIO_PRIVATE_PAD
 
@@ -90,6 +91,8 @@
 	  NULL,						/* stdio	*/ \
 	  0,						/* lpos		*/ \
 	  0,						/* iosz		*/ \
+	  0,						/* blksz	*/ \
+	  0,						/* straddle	*/ \
 	  0						/* getr		*/ \
 	}
 
@@ -118,6 +121,8 @@
 	  (f)->stdio = NULL,				/* stdio	*/ \
 	  (f)->lpos = 0,				/* lpos		*/ \
 	  (f)->iosz = 0,				/* iosz		*/ \
+	  (f)->blksz = 0,				/* blksz	*/ \
+	  (f)->straddle = 0,				/* straddle	*/ \
 	  (f)->getr = 0					/* getr		*/ \
 	)
 
@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1985-2011 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2024 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -39,6 +39,15 @@
 #define STK_SMALL	1		/* allocate small stack frames	*/
 #define STK_NULL	2		/* return NULL on overflow	*/
 
+typedef struct _stkstat_s
+{
+	size_t		size;		/* bytes in the frames in use	*/
+	size_t		peak;		/* high-water mark of size	*/
+	size_t		spare;		/* bytes in frames kept for reuse */
+	size_t		frames;		/* number of frames in use	*/
+	size_t		allocs;		/* frames allocated with malloc	*/
+} Stkstat_t;
+
 #define	stkptr(sp,n)	((char*)((sp)->_data)+(n))
 #define stktop(sp)	((char*)(sp)->_next)
 #define	stktell(sp)	((sp)->_next-(sp)->_data)
@@ -57,5 +66,6 @@ extern void*		stkset(Stk_t*, void*, size_t);
 extern void*		_stkseek(Stk_t*, ssize_t);
 extern void*		stkfreeze(Stk_t*, size_t);
 extern int		stkon(Stk_t*, char*);
+extern int		stkstat(Stk_t*, Stkstat_t*, int);
 
 #endif
@@ -105,6 +105,11 @@ typedef int (*Stat_f)(const char*, struct stat*);
 #ifdef D_TYPE
 #define ISTYPE(f,t)	((f)->type == (t))
 #define TYPE(f,t)	((f)->type = (t))
+#ifdef DTTOIF
+#define MODE(f)		DTTOIF((f)->type)
+#else
+#define MODE(f)		0
+#endif
 #define SKIP(p,f)	((f)->fts_parent->must == 0 && (((f)->type == DT_UNKNOWN) ? SKIPLINK(p,f) : ((f)->type != DT_DIR && ((f)->type != DT_LNK || ((p)->flags & FTS_PHYSICAL)))))
 #else
 #undef	DT_UNKNOWN
@@ -113,6 +118,7 @@ typedef int (*Stat_f)(const char*, struct stat*);
 #define DT_LNK		1
 #define ISTYPE(f,t)	((t)==DT_UNKNOWN)
 #define TYPE(f,d)
+#define MODE(f)		0
 #define SKIP(p,f)	((f)->fts_parent->must == 0 && SKIPLINK(p,f))
 #endif
 
@@ -1064,7 +1070,15 @@ fts_read(FTS* fts)
 					f->fts_info = FTS_DOT;
 				}
 				else if ((fts->nostat || SKIP(fts, f)) && (f->fts_info = FTS_NSOK) || info(fts, f, s, &f->statb, fts->flags))
+				{
 					f->statb.st_ino = D_FILENO(d);
+					/*
+					 * with FTS_DTYPE the st_mode file type is from readdir() if known, 0 otherwise
+					 */
+
+					if (fts->flags & FTS_DTYPE)
+						f->statb.st_mode = MODE(f);
+				}
 				if (fts->comparf)
 					fts->root = search(f, fts->root, fts->comparf, 1);
 				else if (fts->children || f->fts_info == FTS_D || f->fts_info == FTS_SL)
@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1985-2012 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2024 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -4360,6 +4360,20 @@ optget(char** argv, const char* oopts)
 		if (!argv)
 			return 0;
 		pass = &state.pass[n];
+		if ((pass->flags & OPT_cache) && (cache = newof(0, Optcache_t, 1, 0)))
+		{
+			/*
+			 * keep the parsed usage so later calls need not
+			 * init() it again; the short option table is
+			 * filled in when the first option is seen
+			 */
+
+			cache->pass = *pass;
+			cache->next = state.cache;
+			state.cache = cache;
+			pass = &cache->pass;
+			state.npass = -1;
+		}
 	}
 	opts = pass->opts;
 	prefix = pass->prefix;
@@ -4392,8 +4406,11 @@ optget(char** argv, const char* oopts)
 			if (opt_info.index == 1 && opt_info.argv != state.strv)
 			{
 				opt_info.argv = 0;
-				state.argv[0] = 0;
-				if (argv[0] && (state.argv[0] = save(argv[0], strlen(argv[0]), 0, 0, 0, 0)))
+				if (!argv[0])
+					state.argv[0] = 0;
+				else if (!state.argv[0] || strcmp(argv[0], state.argv[0]))
+					state.argv[0] = save(argv[0], strlen(argv[0]), 0, 0, 0, 0);
+				if (state.argv[0])
 					opt_info.argv = state.argv;
 				state.style = STYLE_short;
 			}
@@ -4595,7 +4612,7 @@ optget(char** argv, const char* oopts)
 		a = 0;
 		if (!w && (pass->flags & OPT_cache))
 		{
-			if (cache)
+			if (cache && cache->ready)
 			{
 				if (c >= 0 && c < sizeof(map) && map[c] && cache->equiv[map[c]])
 					c = cache->equiv[map[c]];
@@ -4683,13 +4700,10 @@ optget(char** argv, const char* oopts)
 				}
 				cache = 0;
 			}
-			else if (cache = newof(0, Optcache_t, 1, 0))
+			else if (cache)
 			{
 				cache->caching = c;
 				c = 0;
-				cache->pass = *pass;
-				cache->next = state.cache;
-				state.cache = cache;
 			}
 		}
 		else
@@ -4713,6 +4727,7 @@ optget(char** argv, const char* oopts)
 						cache->flags[0] = 0;
 						c = cache->caching;
 						cache->caching = 0;
+						cache->ready = 1;
 						cache = 0;
 						s = opts;
 						continue;
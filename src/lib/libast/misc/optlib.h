@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1985-2011 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2022 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -70,6 +70,7 @@ typedef struct Optcache_s
 	struct Optcache_s*	next;
 	Optpass_t		pass;
 	int			caching;
+	int			ready;		/* flags and equiv are filled in */
 	unsigned char		flags[sizeof(OPT_FLAGS)];
 	char			equiv[sizeof(OPT_FLAGS)];	/* short option equivalents */
 } Optcache_t;
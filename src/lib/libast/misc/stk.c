@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1985-2012 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2024 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -47,11 +47,16 @@
  * Frames have structure
  *	struct frame
  *	data
+ *
+ * Frames popped by stkset() are kept on a spare list, up to STK_SPARE bytes,
+ * and reused by stkgrow(), so that a stack that is repeatedly grown and reset
+ * (as the shell does for every command) does not call malloc(3) each time.
  */
 
 #define STK_ALIGN	ALIGN_BOUND
 #define STK_FSIZE	(1024*sizeof(char*))
 #define STK_HDRSIZE	(sizeof(Sfio_t)+sizeof(Sfdisc_t))
+#define STK_SPARE	(64*STK_FSIZE)
 
 typedef void* (*_stk_overflow_)(size_t);
 typedef char* (*_old_stk_overflow_)(size_t);	/* for stkinstall (deprecated) */
@@ -76,11 +81,17 @@ struct stk
 	short		stkflags;	/* stack attributes */
 	char		*stkbase;	/* beginning of current stack frame */
 	char		*stkend;	/* end of current stack frame */
+	char		*stkspare;	/* frames kept for reuse */
+	size_t		stksparesize;	/* bytes in the spare frames */
+	size_t		stksize;	/* bytes in the frames in use */
+	size_t		stkpeak;	/* high-water mark of stksize */
+	size_t		stkallocs;	/* frames allocated */
 };
 
 static size_t		init;		/* 1 when initialized */
 static struct stk	*stkcur;	/* pointer to current stk */
 static char		*stkgrow(Sfio_t*, size_t);
+static void		stkrelease(struct stk*, struct frame*);
 
 #define stream2stk(stream)	((stream)==stkstd? stkcur:\
 				 ((struct stk*)(((char*)(stream))+STK_HDRSIZE)))
@@ -143,6 +154,11 @@ static int stkexcept(Sfio_t *stream, int type, void* val, Sfdisc_t* dp)
 							break;
 						}
 					}
+					while(cp = sp->stkspare)
+					{
+						sp->stkspare = ((struct frame*)cp)->prev;
+						free(cp);
+					}
 				}
 			}
 			stream->_data = stream->_next = 0;
@@ -214,6 +230,8 @@ Sfio_t *stkopen(int flags)
 	fp->nalias = 0;
 	fp->aliases = 0;
 	fp->end = sp->stkend = cp+bsize;
+	sp->stksize = sp->stkpeak = bsize+sizeof(struct frame);
+	sp->stkallocs = 1;
 	if(!sfnew(stream,cp,bsize,-1,SFIO_STRING|SFIO_WRITE|SFIO_STATIC|SFIO_EOF))
 		return NULL;
 	sfdisc(stream,dp);
@@ -302,6 +320,35 @@ int stkon(Sfio_t * stream, char* loc)
 			return 1;
 	return 0;
 }
+/*
+ * fill in the statistics for <stream> if <st> is not null
+ * if <clear> is non-zero, restart the high-water mark and allocation count
+ */
+int stkstat(Sfio_t *stream, Stkstat_t *st, int clear)
+{
+	struct stk *sp;
+	struct frame *fp;
+	if(!init)
+		stkinit(1);
+	sp = stream2stk(stream);
+	if(st)
+	{
+		st->size = sp->stksize;
+		st->peak = sp->stkpeak;
+		st->spare = sp->stksparesize;
+		st->allocs = sp->stkallocs;
+		st->frames = 0;
+		for(fp=(struct frame*)sp->stkbase; fp; fp=(struct frame*)fp->prev)
+			st->frames++;
+	}
+	if(clear)
+	{
+		sp->stkpeak = sp->stksize;
+		sp->stkallocs = 0;
+	}
+	return 0;
+}
+
 /*
  * reset the bottom of the current stack back to <address>
  * if <address> is null, then the stack is reset to the beginning
@@ -343,7 +390,7 @@ void *stkset(Sfio_t *stream, void *address, size_t offset)
 		{
 			sp->stkbase = fp->prev;
 			sp->stkend = ((struct frame*)(fp->prev))->end;
-			free(fp);
+			stkrelease(sp,fp);
 		}
 		else
 			break;
@@ -460,6 +507,46 @@ char	*stkcopy(Sfio_t *stream, const char* str)
 	return (char*)cp;
 }
 
+/*
+ * keep the popped frame <fp> on the spare list if there is room, else free it
+ * frames of STK_SMALL stacks are not kept as there may be many such stacks
+ */
+static void stkrelease(struct stk *sp, struct frame *fp)
+{
+	size_t size = fp->end - (char*)fp;
+	sp->stksize -= size;
+	if(!(sp->stkflags&STK_SMALL) && sp->stksparesize+size <= STK_SPARE)
+	{
+		fp->prev = sp->stkspare;
+		sp->stkspare = (char*)fp;
+		sp->stksparesize += size;
+	}
+	else
+		free(fp);
+}
+
+/*
+ * take a spare frame of at least *<n> bytes off the spare list
+ * *<n> is set to the size of the frame
+ */
+static char *stkreuse(struct stk *sp, size_t *n)
+{
+	char **pp, *cp;
+	size_t size;
+	for(pp = &sp->stkspare; cp = *pp; pp = &((struct frame*)cp)->prev)
+	{
+		size = ((struct frame*)cp)->end - cp;
+		if(size >= *n)
+		{
+			*pp = ((struct frame*)cp)->prev;
+			sp->stksparesize -= size;
+			*n = size;
+			return cp;
+		}
+	}
+	return NULL;
+}
+
 /*
  * add a new stack frame of size >= <n> to the current stack.
  * if <n> > 0, copy the bytes from stkbot to stktop to the new stack
@@ -492,9 +579,16 @@ static char *stkgrow(Sfio_t *stream, size_t size)
 		oldbase = dp;
 	}
 	endoff = end - dp;
-	cp = newof(dp, char, n, nn*sizeof(char*));
-	if(!cp && (!sp->stkoverflow || !(cp = (*sp->stkoverflow)(n))))
-		return NULL;
+	if(dp || !(cp = stkreuse(sp,&n)))
+	{
+		cp = newof(dp, char, n, nn*sizeof(char*));
+		if(!cp && (!sp->stkoverflow || !(cp = (*sp->stkoverflow)(n))))
+			return NULL;
+		sp->stkallocs++;
+	}
+	sp->stksize += n - endoff;
+	if(sp->stksize > sp->stkpeak)
+		sp->stkpeak = sp->stksize;
 	if(dp==cp)
 	{
 		nn--;
@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1985-2011 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2023 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -31,10 +31,18 @@
 
 typedef unsigned long Key_t;
 
+typedef union Head_u			/* size of a regcomp() block	*/
+{
+	size_t		size;
+	long double	align;
+} Head_t;
+
 typedef struct Cache_s
 {
 	char*		pattern;
 	regex_t		re;
+	regdisc_t	disc;
+	size_t		bytes;		/* held by the compiled re	*/
 	unsigned long	serial;
 	regflags_t	reflags;
 	int		keep;
@@ -45,12 +53,45 @@ typedef struct State_s
 {
 	unsigned int	size;
 	unsigned long	serial;
+	unsigned long	comps;
 	char*		locale;
 	Cache_t**	cache;
 } State_t;
 
 static State_t	matchstate;
 
+/*
+ * regcomp() allocator that counts the bytes held by a cache entry
+ */
+
+static void*
+resize(void* handle, void* p, size_t n)
+{
+	Cache_t*	cp = (Cache_t*)handle;
+	Head_t*		hp = 0;
+	Head_t*		np;
+
+	if (p)
+	{
+		hp = (Head_t*)p - 1;
+		cp->bytes -= hp->size;
+	}
+	if (!n)
+	{
+		free(hp);
+		return NULL;
+	}
+	if (!(np = (Head_t*)realloc(hp, sizeof(Head_t) + n)))
+	{
+		if (hp)
+			cp->bytes += hp->size;
+		return NULL;
+	}
+	np->size = n;
+	cp->bytes += n;
+	return np + 1;
+}
+
 /*
  * flush the cache
  */
@@ -177,7 +218,11 @@ regcache(const char* pattern, regflags_t reflags, int* status)
 		while (++i < sizeof(Key_t))
 			cp->pattern[i] = 0;
 		pattern = (const char*)cp->pattern;
-		if (i = regcomp(&cp->re, pattern, reflags))
+		memset(&cp->disc, 0, sizeof(cp->disc));
+		cp->disc.re_resizef = resize;
+		cp->disc.re_resizehandle = cp;
+		cp->re.re_disc = &cp->disc;
+		if (i = regcomp(&cp->re, pattern, reflags|REG_DISCIPLINE))
 		{
 			if (status)
 				*status = i;
@@ -185,6 +230,7 @@ regcache(const char* pattern, regflags_t reflags, int* status)
 		}
 		cp->keep = 1;
 		cp->reflags = reflags;
+		matchstate.comps++;
 	}
 	else
 		cp = matchstate.cache[i];
@@ -193,3 +239,42 @@ regcache(const char* pattern, regflags_t reflags, int* status)
 		*status = 0;
 	return &cp->re;
 }
+
+/*
+ * return the number of patterns compiled by regcache() so far
+ */
+
+unsigned long
+regcachecomps(void)
+{
+	return matchstate.comps;
+}
+
+/*
+ * return the number of compiled patterns in the cache
+ * and store the bytes they and the cache hold in *bytes
+ */
+
+unsigned long
+regcachesize(size_t* bytes)
+{
+	Cache_t*	cp;
+	unsigned long	n = 0;
+	size_t		b;
+	int		i;
+
+	b = matchstate.size * sizeof(Cache_t*);
+	for (i = matchstate.size; i--;)
+		if (cp = matchstate.cache[i])
+		{
+			b += sizeof(Cache_t) + cp->size;
+			if (cp->keep)
+			{
+				b += cp->bytes;
+				n++;
+			}
+		}
+	if (bytes)
+		*bytes = b;
+	return n;
+}
@@ -32,7 +32,6 @@ static char		*Zero = "0";
 #define SFIO_INF		((_Sfi = 3), strlcpy(buf, (format & SFFMT_UPPER) ? uc_inf : lc_inf, size), buf)
 #define SFIO_NAN		((_Sfi = 3), strlcpy(buf, (format & SFFMT_UPPER) ? uc_nan : lc_nan, size), buf)
 #define SFIO_ZERO		((_Sfi = 1), strlcpy(buf, Zero, size), buf)
-#define SFIO_INTPART	(SFIO_IDIGITS/2)
 
 #if !_lib_isnan || __ANDROID_API__
 #undef	isnan
@@ -88,22 +87,6 @@ static int neg0d(double f)
 }
 #endif
 
-#if UINT_DIG && UINT_DIG < (DBL_DIG-1) && !(ULONG_DIG && ULONG_DIG < (DBL_DIG-1))
-#define CVT_LDBL_INT	int
-#define CVT_LDBL_MAXINT	INT_MAX
-#else
-#define CVT_LDBL_INT	long
-#define CVT_LDBL_MAXINT	LONG_MAX
-#endif
-
-#if UINT_DIG && UINT_DIG < (DBL_DIG-1) && !(ULONG_DIG && ULONG_DIG < (DBL_DIG-1))
-#define CVT_DBL_INT	int
-#define CVT_DBL_MAXINT	INT_MAX
-#else
-#define CVT_DBL_INT	long
-#define CVT_DBL_MAXINT	LONG_MAX
-#endif
-
 char* _sfcvt(void*	vp,		/* pointer to value to convert	*/
 	     char*	buf,		/* conversion goes here		*/
 	     size_t	size,		/* size of buf			*/
@@ -114,7 +97,7 @@ char* _sfcvt(void*	vp,		/* pointer to value to convert	*/
 	     int	format)		/* conversion format		*/
 {
 	char			*sp;
-	long			n, v;
+	long			n;
 	char			*ep, *b, *endsp, *t;
 	int			x;
 	_ast_flt_unsigned_max_t	m;
@@ -190,90 +173,7 @@ char* _sfcvt(void*	vp,		/* pointer to value to convert	*/
 			}
 		}
 
-		n = 0;
-		if(f >= (Sfdouble_t)CVT_LDBL_MAXINT)
-		{	/* scale to a small enough number to fit an int */
-			v = SFIO_MAXEXP10-1;
-			do
-			{	if(f < _Sfpos10[v])
-					v -= 1;
-				else
-				{
-					f *= _Sfneg10[v];
-					if((n += (1<<v)) >= SFIO_IDIGITS)
-						return SFIO_INF;
-				}
-			} while(f >= (Sfdouble_t)CVT_LDBL_MAXINT);
-		}
-		else if(f > 0.0 && f < 0.1)
-		{	/* scale to avoid excessive multiply by 10 below */
-			v = SFIO_MAXEXP10-1;
-			do
-			{	if(f <= _Sfneg10[v])
-				{	f *= _Sfpos10[v];
-					if((n += (1<<v)) >= SFIO_IDIGITS)
-						return SFIO_INF;
-				}
-				else if (--v < 0)
-					break;
-			} while(f < 0.1);
-			n = -n;
-		}
-		*decpt = (int)n;
-
-		b = sp = buf + SFIO_INTPART;
-		if((v = (CVT_LDBL_INT)f) != 0)
-		{	/* translate the integer part */
-			f -= (Sfdouble_t)v;
-
-			sfucvt(v,sp,n,ep,CVT_LDBL_INT,unsigned CVT_LDBL_INT);
-
-			n = b-sp;
-			if((*decpt += (int)n) >= SFIO_IDIGITS)
-				return SFIO_INF;
-			b = sp;
-			sp = buf + SFIO_INTPART;
-		}
-		else	n = 0;
-
-		/* remaining number of digits to compute; add 1 for later rounding */
-		n = (((format&SFFMT_EFORMAT) || *decpt <= 0) ? 1 : *decpt+1) - n;
-		if(n_digit > 0)
-		{	if(n_digit > LDBL_DIG)
-				n_digit = LDBL_DIG;
-			n += n_digit;
-		}
-
-		if((ep = (sp+n)) > (endsp = buf+(size-2)))
-			ep = endsp; 
-		if(sp > ep)
-			sp = ep;
-		else
-		{
-			if((format&SFFMT_EFORMAT) && *decpt == 0 && f > 0.)
-			{	Sfdouble_t	d;
-				while((long)(d = f*10.) == 0)
-				{	f = d;
-					*decpt -= 1;
-				}
-			}
-
-			while(sp < ep)
-			{	/* generate fractional digits */
-				if(f <= 0. && *decpt >= 0)
-				{	/* fill with 0's */
-					do { *sp++ = '0'; } while(sp < ep);
-					goto done;
-				}
-				else if((n = (long)(f *= 10.)) < 10)
-				{	*sp++ = '0' + n;
-					f -= n;
-				}
-				else /* n == 10 */
-				{	do { *sp++ = '9'; } while(sp < ep);
-				}
-			}
-		}
+		n = _sfdtoa(f, LDBL_MANT_DIG, n_digit, format, buf, size, decpt);
 	} else
 #endif
 	{	double	f = *(double*)vp;
@@ -339,122 +239,10 @@ char* _sfcvt(void*	vp,		/* pointer to value to convert	*/
 				f = ldexp(f, 8 * sizeof(m));
 			}
 		}
-		n = 0;
-		if(f >= (double)CVT_DBL_MAXINT)
-		{	/* scale to a small enough number to fit an int */
-			v = SFIO_MAXEXP10-1;
-			do
-			{	if(f < _Sfpos10[v])
-					v -= 1;
-				else
-				{	f *= _Sfneg10[v];
-					if((n += (1<<v)) >= SFIO_IDIGITS)
-						return SFIO_INF;
-				}
-			} while(f >= (double)CVT_DBL_MAXINT);
-		}
-		else if(f > 0.0 && f < 0.1)
-		{	/* scale to avoid excessive multiply by 10 below */
-			v = SFIO_MAXEXP10-1;
-			do
-			{	if(f <= _Sfneg10[v])
-				{	f *= _Sfpos10[v];
-					if((n += (1<<v)) >= SFIO_IDIGITS)
-						return SFIO_INF;
-				}
-				else if(--v < 0)
-					break;
-			} while(f < 0.1);
-			n = -n;
-		}
-		*decpt = (int)n;
-
-		b = sp = buf + SFIO_INTPART;
-		if((v = (CVT_DBL_INT)f) != 0)
-		{	/* translate the integer part */
-			f -= (double)v;
-
-			sfucvt(v,sp,n,ep,CVT_DBL_INT,unsigned CVT_DBL_INT);
-
-			n = b-sp;
-			if((*decpt += (int)n) >= SFIO_IDIGITS)
-				return SFIO_INF;
-			b = sp;
-			sp = buf + SFIO_INTPART;
-		}
-		else	n = 0;
-
-		/* remaining number of digits to compute; add 1 for later rounding */
-		n = (((format&SFFMT_EFORMAT) || *decpt <= 0) ? 1 : *decpt+1) - n;
-		if(n_digit > 0)
-		{	if(n_digit > DBL_DIG)
-				n_digit = DBL_DIG;
-			n += n_digit;
-		}
-
-		if((ep = (sp+n)) > (endsp = buf+(size-2)))
-			ep = endsp; 
-		if(sp > ep)
-			sp = ep;
-		else
-		{
-			if((format&SFFMT_EFORMAT) && *decpt == 0 && f > 0.)
-			{	double	d;
-				while((long)(d = f*10.) == 0)
-				{	f = d;
-					*decpt -= 1;
-				}
-			}
-
-			while(sp < ep)
-			{	/* generate fractional digits */
-				if(f <= 0. && *decpt >= 0)
-				{	/* fill with 0's */
-					do { *sp++ = '0'; } while(sp < ep);
-					goto done;
-				}
-				else if((n = (long)(f *= 10.)) < 10)
-				{	*sp++ = (char)('0' + n);
-					f -= n;
-				}
-				else /* n == 10 */
-				{	do { *sp++ = '9'; } while(sp < ep);
-					break;
-				}
-			}
-		}
-	}
-
-	if(ep <= b)
-		ep = b+1;
-	else if(ep < endsp)
-	{	/* round the last digit */
-		if (!(format&SFFMT_EFORMAT) && *decpt < 0)
-			sp += *decpt-1;
-		else
-			--sp;
-		*sp += 5;
-		while(*sp > '9')
-		{	if(sp > b)
-			{	*sp = '0';
-				*--sp += 1;
-			}
-			else
-			{	/* next power of 10 and at beginning */
-				*sp = '1';
-				*decpt += 1;
-				if(!(format&SFFMT_EFORMAT))
-				{	/* add one more 0 for %f precision */
-					if (sp != &ep[-1])
-					{	/* prevents overwriting the previous 1 with 0 */
-						ep[-1] = '0';
-					}
-					ep += 1;
-				}
-				break;
-			}
-		}
+		n = _sfdtoa(f, DBL_MANT_DIG, n_digit, format, buf, size, decpt);
 	}
+	b = buf;
+	ep = buf + n + 1;
 
  done:
 	*--ep = '\0';
@@ -0,0 +1,712 @@
+/***********************************************************************
+*                                                                      *
+*               This software is part of the ast package               *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
+*                      and is licensed under the                       *
+*                 Eclipse Public License, Version 2.0                  *
+*                                                                      *
+*                A copy of the License is available at                 *
+*      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      *
+*         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         *
+*                                                                      *
+*                  Martijn Dekker <martijn@inlv.org>                   *
+*                                                                      *
+***********************************************************************/
+#include	"sfhdr.h"
+#include	"FEATURE/float"
+
+/*	Exact conversion between binary and decimal floating point.
+**
+**	_sfdtoa() generates the correctly rounded or the shortest round trip
+**	decimal digits of a value for _sfcvt(). _sfdtof() correctly rounds a
+**	decimal digit string to a binary value for the strtod() family when
+**	their floating point fast path cannot guarantee the result.
+**	Both work on exact big integers: digits are generated as in Steele &
+**	White's (FPP)2 and Dragon4, and decimal values are rounded by a long
+**	division as in Clinger's algorithm M. Most values never get there:
+**	a floating point product with an error bound settles the rounding
+**	unless it is too close to a tie, and a parsed value is refined from
+**	a floating point estimate by comparing it with exact midpoints.
+*/
+
+#if _ast_fltmax_double
+#define DEC_MANT	DBL_MANT_DIG
+#define DEC_EPS		DBL_EPSILON
+#define DEC_MIN		DBL_MIN
+#define DEC_MAX		DBL_MAX
+#define DEC_MIN10	DBL_MIN_10_EXP
+#define DEC_MAX10	DBL_MAX_10_EXP
+#define DEC_MAXEXP	DBL_MAX_EXP
+#define DEC_POW10	_Sfdpow10
+#else
+#define DEC_MANT	LDBL_MANT_DIG
+#define DEC_EPS		LDBL_EPSILON
+#define DEC_MIN		LDBL_MIN
+#define DEC_MAX		LDBL_MAX
+#define DEC_MIN10	LDBL_MIN_10_EXP
+#define DEC_MAX10	LDBL_MAX_10_EXP
+#define DEC_MAXEXP	LDBL_MAX_EXP
+#define DEC_POW10	_Sflpow10
+#endif
+
+/* largest exact power of 10 */
+#if DEC_MANT >= 113
+#define DEC_EXACT	48
+#elif DEC_MANT >= 64
+#define DEC_EXACT	27
+#else
+#define DEC_EXACT	22
+#endif
+
+#define DEC_TRIES	8	/* refinement steps before the long division */
+
+#define BIG_BITS	((SFIO_DECDIG - DEC_MIN10 + 2) * 10 / 3 + 2 * DEC_MANT)
+#define BIG_LIMBS	(BIG_BITS / 32 + 4)
+
+typedef struct _big_s
+{	int		n;		/* number of limbs in use	*/
+	uint32_t	d[BIG_LIMBS];	/* limbs, least significant first	*/
+} Big_t;
+
+static void bigset(Big_t* b, uint32_t v)
+{
+	b->d[0] = v;
+	b->n = v != 0;
+}
+
+static void bigcpy(Big_t* b, Big_t* a)
+{
+	memcpy(b->d, a->d, a->n * sizeof(a->d[0]));
+	b->n = a->n;
+}
+
+/* b = b*m + a */
+static void bigmul(Big_t* b, uint32_t m, uint32_t a)
+{
+	Sfulong_t	c = a;
+	int		i;
+
+	for(i = 0; i < b->n; i++)
+	{	c += (Sfulong_t)b->d[i] * m;
+		b->d[i] = (uint32_t)c;
+		c >>= 32;
+	}
+	if(c)
+		b->d[b->n++] = (uint32_t)c;
+}
+
+/* b *= 10^k */
+static void bigpow10(Big_t* b, int k)
+{
+	static const uint32_t	p10[] = { 1, 10, 100, 1000, 10000, 100000,
+					  1000000, 10000000, 100000000, 1000000000 };
+
+	for(; k >= 9; k -= 9)
+		bigmul(b, p10[9], 0);
+	if(k > 0)
+		bigmul(b, p10[k], 0);
+}
+
+static void bigshl(Big_t* b, int s)
+{
+	int		w = s / 32, i;
+
+	if(!b->n || !s)
+		return;
+	if(s %= 32)
+	{	b->d[b->n] = 0;
+		for(i = b->n; i > 0; i--)
+			b->d[i] = (b->d[i] << s) | (b->d[i-1] >> (32 - s));
+		b->d[0] <<= s;
+		if(b->d[b->n])
+			b->n++;
+	}
+	if(w)
+	{	memmove(b->d + w, b->d, b->n * sizeof(b->d[0]));
+		memset(b->d, 0, w * sizeof(b->d[0]));
+		b->n += w;
+	}
+}
+
+static void bigshr(Big_t* b, int s)
+{
+	int		w = s / 32, i;
+
+	if(w >= b->n)
+	{	b->n = 0;
+		return;
+	}
+	if(w)
+	{	memmove(b->d, b->d + w, (b->n -= w) * sizeof(b->d[0]));
+	}
+	if(s %= 32)
+	{	for(i = 0; i < b->n - 1; i++)
+			b->d[i] = (b->d[i] >> s) | (b->d[i+1] << (32 - s));
+		b->d[i] >>= s;
+	}
+	while(b->n && !b->d[b->n-1])
+		b->n--;
+}
+
+static int bigbits(Big_t* b)
+{
+	uint32_t	t;
+	int		n;
+
+	if(!b->n)
+		return 0;
+	for(n = 0, t = b->d[b->n-1]; t; t >>= 1)
+		n++;
+	return (b->n - 1) * 32 + n;
+}
+
+/* bit i of b */
+static int bigbit(Big_t* b, int i)
+{
+	return i / 32 < b->n && (b->d[i / 32] >> (i % 32) & 1);
+}
+
+static int bigcmp(Big_t* a, Big_t* b)
+{
+	int		i;
+
+	if(a->n != b->n)
+		return a->n < b->n ? -1 : 1;
+	for(i = a->n; i-- > 0; )
+		if(a->d[i] != b->d[i])
+			return a->d[i] < b->d[i] ? -1 : 1;
+	return 0;
+}
+
+/* a -= b, a >= b */
+static void bigsub(Big_t* a, Big_t* b)
+{
+	Sflong_t	c = 0;
+	int		i;
+
+	for(i = 0; i < a->n; i++)
+	{	c += (Sflong_t)a->d[i] - (i < b->n ? b->d[i] : 0);
+		a->d[i] = (uint32_t)c;
+		c = c < 0 ? -1 : 0;
+	}
+	while(a->n && !a->d[a->n-1])
+		a->n--;
+}
+
+/* r = a + b */
+static void bigadd(Big_t* r, Big_t* a, Big_t* b)
+{
+	Sfulong_t	c = 0;
+	int		i, n = a->n > b->n ? a->n : b->n;
+
+	for(i = 0; i < n; i++)
+	{	c += (Sfulong_t)(i < a->n ? a->d[i] : 0) + (i < b->n ? b->d[i] : 0);
+		r->d[i] = (uint32_t)c;
+		c >>= 32;
+	}
+	if(c)
+		r->d[i++] = (uint32_t)c;
+	r->n = i;
+}
+
+/* exact value of b, which must fit the Sfdouble_t mantissa */
+static Sfdouble_t bigval(Big_t* b)
+{
+	Sfdouble_t	v = 0;
+	int		i;
+
+	for(i = b->n; i-- > 0; )
+		v = v * 4294967296.0 + b->d[i];
+	return v;
+}
+
+/* leading part of b as a double, scaled by 2^(-32*(n-4)) */
+static double bighead(Big_t* b, int n)
+{
+	double		v = 0;
+	int		i;
+
+	for(i = n; i-- > n - 4; )
+		v = v * 4294967296.0 + (i >= 0 && i < b->n ? b->d[i] : 0);
+	return v;
+}
+
+/* next digit of r/s, r = 10*r mod s */
+static int bigdigit(Big_t* r, Big_t* s)
+{
+	Sfulong_t	m;
+	Sflong_t	c;
+	int		d, i;
+
+	bigmul(r, 10, 0);
+	if(bigcmp(r, s) < 0)
+		return 0;
+	/* an estimate from the leading limbs, at most one short */
+	if((d = (int)(bighead(r, r->n) / bighead(s, r->n) - 1e-8)) > 0)
+	{	for(c = 0, m = 0, i = 0; i < r->n; i++)
+		{	m += (Sfulong_t)(i < s->n ? s->d[i] : 0) * d;
+			c += (Sflong_t)r->d[i] - (uint32_t)m;
+			r->d[i] = (uint32_t)c;
+			m >>= 32;
+			c = c < 0 ? -1 : 0;
+		}
+		while(r->n && !r->d[r->n-1])
+			r->n--;
+	}
+	else	d = 0;
+	while(bigcmp(r, s) >= 0)
+	{	bigsub(r, s);
+		d++;
+	}
+	return d;
+}
+
+/* r = a * m */
+static void bigmul64(Big_t* r, Big_t* a, Sfulong_t m)
+{
+	uint32_t	w[2];
+	Sfulong_t	c;
+	int		i, j;
+
+	w[0] = (uint32_t)m;
+	w[1] = (uint32_t)(m >> 32);
+	memset(r->d, 0, (a->n + 2) * sizeof(r->d[0]));
+	for(j = 0; j < 2; j++)
+	{	for(c = 0, i = 0; i < a->n; i++)
+		{	c += (Sfulong_t)a->d[i] * w[j] + r->d[i+j];
+			r->d[i+j] = (uint32_t)c;
+			c >>= 32;
+		}
+		r->d[i+j] = (uint32_t)c;
+	}
+	for(r->n = a->n + 2; r->n && !r->d[r->n-1]; r->n--);
+}
+
+static const Sfulong_t	p10[] =
+{
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+	10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+	100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+	100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+	100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+};
+
+/* f * 10^t rounded to an integer in *d, 0 if too close to a tie to tell */
+static int fastround(Sfdouble_t f, int t, Sfulong_t* d)
+{
+	Sfdouble_t	w, r;
+	Sfulong_t	q;
+
+	if(t > DEC_EXACT || t < -DEC_EXACT)
+		return 0;
+	w = t >= 0 ? f * DEC_POW10[t] : f / DEC_POW10[-t];
+	if(w >= 1e19)
+		return 0;
+	q = (Sfulong_t)w;
+	if((r = w - q - 0.5) < 0)
+		r = -r;
+	if(r <= w * DEC_EPS)
+		return 0;
+	*d = q + (w - q > 0.5);
+	return 1;
+}
+
+/*	f rounded to n significant digits, or to n places after the decimal
+**	point if fixed, in *d with the decimal exponent in *k adjusted to
+**	match. The number of digits in *d is returned, 0 if undecided.
+*/
+static int fastdigits(Sfdouble_t f, int n, int fixed, int* k, Sfulong_t* d)
+{
+	int		i, cnt;
+
+	for(i = 0; i < 2; i++)
+	{	cnt = fixed ? n + *k : n;
+		if(cnt <= 0 || cnt >= (int)elementsof(p10) || !fastround(f, cnt - *k, d))
+			return 0;
+		if(*d < p10[cnt-1])
+			*k -= 1;
+		else if(*d > p10[cnt])
+			*k += 1;
+		else
+		{	if(*d == p10[cnt])
+			{	/* rounded up to the next power of 10 */
+				*k += 1;
+				if(fixed)
+					cnt++;
+				else	*d /= 10;
+			}
+			return cnt;
+		}
+	}
+	return 0;
+}
+
+/* the n digits of d in buf */
+static int putdigits(char* buf, Sfulong_t d, int n)
+{
+	int		i;
+
+	for(i = n; i-- > 0; d /= 10)
+		buf[i] = '0' + (int)(d % 10);
+	buf[n] = 0;
+	return n;
+}
+
+/* add one unit in the last place of the n digits in buf, return 1 on carry out */
+static int roundup(char* buf, int n)
+{
+	while(n-- > 0)
+	{	if(buf[n] != '9')
+		{	buf[n]++;
+			return 0;
+		}
+		buf[n] = '0';
+	}
+	buf[0] = '1';
+	return 1;
+}
+
+/*	Decimal digits of f, a positive normal number with p significant bits.
+**	With SFFMT_SHORTEST the digits are the shortest that read back as f,
+**	padded with 0s to n digits. Otherwise they are rounded half to even
+**	to n significant digits for SFFMT_EFORMAT, or to n places after the
+**	decimal point, with 0s past the digits that tell f from its neighbors
+**	as in the shortest form. The number of digits is returned, *decpt is set so
+**	that f is 0.digits * 10^*decpt.
+*/
+int _sfdtoa(Sfdouble_t f, int p, int n, int format, char* buf, int size, int* decpt)
+{
+	Big_t		r, s, mp, mm, t;
+	Sfulong_t	v;
+	Sfdouble_t	g, h;
+	int		x, e, u, k, i, c, d, asym, even, lo, hi, max;
+
+	/* the floating point fast paths */
+	asym = frexpl(f, &x) == 0.5;
+	k = (int)(((Sflong_t)(x - 1) * 1292913986) >> 32) + 1;	/* log10(2) * 2^32 */
+	max = (int)(((Sflong_t)p * 1292913986) >> 32) + 2;	/* enough to tell f from its neighbors */
+	if(!(format&SFFMT_SHORTEST))
+	{	if((c = fastdigits(f, n, !(format&SFFMT_EFORMAT), &k, &v)) && c <= size - 2 && c <= max)
+		{	*decpt = k;
+			return putdigits(buf, v, c);
+		}
+	}
+	else if(!asym)
+	{	/* the first of the roundings from the guaranteed digits up that reads back */
+		h = ldexpl(1.0, x - p - 1);
+		for(i = (int)(((Sflong_t)(p - 1) * 1292913986) >> 32); i < (int)elementsof(p10); i++)
+		{	if(!(c = fastdigits(f, i, 0, &k, &v)) || c - k > DEC_EXACT || k - c > DEC_EXACT)
+				break;
+#if DEC_MANT < 64
+			if(v >> DEC_MANT)
+				break;
+#endif
+			g = (Sfdouble_t)v;
+			g = k >= c ? g * DEC_POW10[k-c] : g / DEC_POW10[c-k];
+			if(p < DEC_MANT)
+			{	/* within half a gap at p bits, allowing for the rounding of g */
+				if((g -= f) < 0)
+					g = -g;
+				if(g > h + f * DEC_EPS)
+					continue;
+				if(g >= h - f * DEC_EPS)
+					break;
+			}
+			else if(g != f)
+				continue;
+			for(; c > 1 && !(v % 10); c--)
+				v /= 10;
+			*decpt = k;
+			putdigits(buf, v, c);
+			for(; c < n && c < size - 1; c++)
+				buf[c] = '0';
+			buf[c] = 0;
+			return c;
+		}
+	}
+
+	/* f = m * 2^e with the m limbs extracted from the most significant end */
+	f = frexpl(f, &x);
+	r.n = (p + 31) / 32;
+	for(i = r.n; i-- > 0; )
+	{	f = ldexpl(f, 32);
+		r.d[i] = (uint32_t)f;
+		f -= r.d[i];
+	}
+	e = x - 32 * r.n;
+	u = e + 32 * r.n - p;	/* exponent of the last place */
+
+	/* with m a power of two the gap below f is half the gap above */
+	for(asym = i = 0; i < r.n - 1 && !r.d[i]; i++);
+	asym = i == r.n - 1 && r.d[i] == 0x80000000;
+	even = !bigbit(&r, u - e);
+
+	/* f = r/s, the gaps to the neighbors are mp/s and mm/s */
+	if((k = u - 1 - asym) > e)
+		k = e;
+	bigshl(&r, e - k);
+	bigset(&mp, 1);
+	bigshl(&mp, u - 1 - k);
+	bigset(&mm, 1);
+	bigshl(&mm, u - 1 - asym - k);
+	bigset(&s, 1);
+	if(k > 0)
+	{	bigshl(&r, k);
+		bigshl(&mp, k);
+		bigshl(&mm, k);
+	}
+	else	bigshl(&s, -k);
+
+	/* scale to 0.1 <= r/s < 1 with an estimate of the decimal exponent */
+	k = (int)(((Sflong_t)(x - 1) * 1292913986) >> 32) + 1;	/* log10(2) * 2^32 */
+	if(k > 0)
+		bigpow10(&s, k);
+	else if(k < 0)
+	{	bigpow10(&r, -k);
+		bigpow10(&mp, -k);
+		bigpow10(&mm, -k);
+	}
+	while(bigcmp(&r, &s) >= 0)
+	{	bigmul(&s, 10, 0);
+		k++;
+	}
+	*decpt = k;
+
+	/* digits past those that tell f from its neighbors are 0 */
+	if(!(format&SFFMT_SHORTEST) && ((format&SFFMT_EFORMAT) ? n : n + k) > max)
+	{	if(!(format&SFFMT_EFORMAT))
+			n += k;
+		format |= SFFMT_SHORTEST;
+	}
+
+	if(format&SFFMT_SHORTEST)
+	{	for(i = 0; i < size - 2; )
+		{	d = bigdigit(&r, &s);
+			bigmul(&mp, 10, 0);
+			bigmul(&mm, 10, 0);
+			c = bigcmp(&r, &mm);
+			lo = c < 0 || (c == 0 && even);
+			bigadd(&t, &r, &mp);
+			c = bigcmp(&t, &s);
+			hi = c > 0 || (c == 0 && even);
+			if(!lo && !hi)
+			{	buf[i++] = '0' + d;
+				continue;
+			}
+			if(lo && hi)
+			{	/* both neighbors in range, take the nearer */
+				bigshl(&r, 1);
+				c = bigcmp(&r, &s);
+				hi = c > 0 || (c == 0 && (d & 1));
+			}
+			if(hi && d == 9)
+			{	buf[i++] = '9';
+				if(roundup(buf, i))
+				{	*decpt += 1;
+					i = 1;
+				}
+				else while(buf[i-1] == '0')
+					i--;
+			}
+			else	buf[i++] = '0' + d + hi;
+			break;
+		}
+		for(; i < n && i < size - 1; i++)
+			buf[i] = '0';
+		buf[i] = 0;
+		return i;
+	}
+
+	if(!(format&SFFMT_EFORMAT))
+		n += k;
+	if(n > size - 2)
+		n = size - 2;
+	if(n <= 0)
+	{	/* rounds to 0 or to a single 1 in the first place after */
+		if(n == 0)
+		{	bigshl(&r, 1);
+			if(bigcmp(&r, &s) > 0)
+			{	*decpt += 1;
+				buf[0] = '1';
+				buf[1] = 0;
+				return 1;
+			}
+		}
+		*decpt = 0;
+		buf[0] = '0';
+		buf[1] = 0;
+		return 1;
+	}
+	for(i = 0; i < n; i++)
+	{	if(!r.n)
+		{	do buf[i++] = '0'; while(i < n);
+			break;
+		}
+		buf[i] = '0' + bigdigit(&r, &s);
+	}
+	bigshl(&r, 1);
+	if((c = bigcmp(&r, &s)) > 0 || (c == 0 && (buf[n-1] & 1)))
+	{	if(roundup(buf, n))
+		{	*decpt += 1;
+			if(!(format&SFFMT_EFORMAT) && n < size - 2)
+				buf[n++] = '0';
+		}
+	}
+	buf[n] = 0;
+	return n;
+}
+
+/*	Position of a/s relative to m * 2^x and the midpoints to its neighbors:
+**	>1 above the upper, <-1 below the lower, +-1 on one, 0 in between.
+**	With asym m is a power of two and the lower midpoint is a quarter gap
+**	below it.
+*/
+static int midcmp(Big_t* a, Big_t* s, Sfulong_t m, int x, int asym)
+{
+	Big_t		l, r, w;
+	int		c;
+
+	/* l = a * 2^(1-x) and r = 2m * s compared in units of s */
+	bigmul64(&r, s, m);
+	bigshl(&r, 1);
+	bigcpy(&l, a);
+	if((x = 1 - x) >= 0)
+		bigshl(&l, x);
+	else
+	{	bigshl(&r, -x);
+		bigcpy(&w, s);
+		bigshl(&w, -x);
+		s = &w;
+	}
+	if(bigcmp(&l, &r) >= 0)
+	{	bigsub(&l, &r);
+		return (c = bigcmp(&l, s)) > 0 ? 2 : c == 0;
+	}
+	bigsub(&r, &l);
+	if(asym)
+		bigshl(&r, 1);
+	return (c = bigcmp(&r, s)) > 0 ? -2 : -(c == 0);
+}
+
+/*	Correctly rounded value of the nd digits in dig, the first nonzero,
+**	times 10^e, to p significant bits.
+*/
+Sfdouble_t _sfdtof(const char* dig, int nd, int e, int p)
+{
+	Big_t		a, s, t;
+	Sfdouble_t	z;
+	Sfulong_t	m, top;
+	int		i, j, c, x, sh, up;
+
+	if(nd + e > DEC_MAX10 + 1)
+		return ldexpl(1.0, DEC_MAXEXP);
+	if(nd + e < DEC_MIN10)
+		return 0;
+
+	bigset(&a, 0);
+	for(i = 0; i < nd; i = j)
+	{	uint32_t	v = 0, m = 1;
+		for(j = i; j < nd && j < i + 9; j++)
+		{	v = v * 10 + (dig[j] - '0');
+			m *= 10;
+		}
+		bigmul(&a, m, v);
+	}
+
+	if(e >= 0)
+	{	bigpow10(&a, e);
+		if((sh = bigbits(&a) - p) <= 0)
+			return bigval(&a);
+		up = bigbit(&a, sh - 1);
+		for(i = 0; up && i < sh - 1; i++)
+			if(bigbit(&a, i))
+				break;
+		bigshr(&a, sh);
+		if(up && (i < sh - 1 || (a.d[0] & 1)))
+		{	bigset(&t, 1);
+			bigadd(&a, &a, &t);
+		}
+		return ldexpl(bigval(&a), sh);
+	}
+
+	bigset(&s, 1);
+	bigpow10(&s, -e);
+
+	/* step an estimate from the leading digits to the nearest value */
+	if(p <= 64)
+	{	for(m = 0, i = 0; i < nd && i < 19; i++)
+			m = m * 10 + (dig[i] - '0');
+		z = (Sfdouble_t)m;
+		for(m = 0, j = i; j < nd && j < 38; j++)
+			m = m * 10 + (dig[j] - '0');
+		if(j > i)
+			z = z * DEC_POW10[j - i] + (Sfdouble_t)m;
+		if((x = nd - j + e) < 0 && -x <= DEC_MAX10)
+			z /= DEC_POW10[-x];
+		else if(x >= 0 && x <= DEC_MAX10)
+			z *= DEC_POW10[x];
+		else	z = 0;
+		if(z >= DEC_MIN && z <= DEC_MAX)
+		{	z = frexpl(z, &x);
+			m = (Sfulong_t)ldexpl(z, p);
+			x -= p;
+			top = (Sfulong_t)1 << (p - 1);
+			for(i = 0; i < DEC_TRIES; i++)
+			{	c = midcmp(&a, &s, m, x, m == top);
+				if(c > 1 || (c == 1 && (m & 1)))
+				{	if(++m == top + top)
+					{	m = top;
+						x++;
+					}
+					if(c > 1)
+						continue;
+				}
+				else if(c < -1 || (c == -1 && (m & 1)))
+				{	if(--m < top)
+					{	m = top + top - 1;
+						x--;
+					}
+					if(c < -1)
+						continue;
+				}
+				return ldexpl((Sfdouble_t)m, x);
+			}
+		}
+	}
+
+	/* a/s with p or p+1 quotient bits by shift and subtract */
+	if((sh = p - bigbits(&a) + bigbits(&s)) >= 0)
+		bigshl(&a, sh);
+	else	bigshl(&s, -sh);
+	bigcpy(&t, &s);
+	bigshl(&t, p);
+	{	Big_t	q;
+		int	nq = p / 32 + 1;
+
+		memset(q.d, 0, nq * sizeof(q.d[0]));
+		for(i = p; i >= 0; i--)
+		{	if(bigcmp(&a, &t) >= 0)
+			{	bigsub(&a, &t);
+				q.d[i / 32] |= (uint32_t)1 << (i % 32);
+			}
+			bigshr(&t, 1);
+		}
+		for(q.n = nq; q.n && !q.d[q.n-1]; q.n--);
+		if(bigbit(&q, p))
+		{	/* p+1 bits: the low bit rounds, the remainder is sticky */
+			up = (q.d[0] & 1) && (a.n || (q.d[0] & 2));
+			bigshr(&q, 1);
+			sh--;
+		}
+		else
+		{	bigshl(&a, 1);
+			i = bigcmp(&a, &s);
+			up = i > 0 || (i == 0 && (q.d[0] & 1));
+		}
+		if(up)
+		{	bigset(&t, 1);
+			bigadd(&q, &q, &t);
+		}
+		return ldexpl(bigval(&q), -sh);
+	}
+}
@@ -43,6 +43,7 @@ Sfextern_t _Sfextern =
 
 ssize_t	_Sfi = -1;		/* value for a few fast macro functions	*/
 ssize_t	_Sfmaxr = 0;		/* default (unlimited) max record size	*/
+ssize_t	_Sfmaxbuf = SFIO_MAXBUF;	/* cap on sequential read buffer growth	*/
 
 Sfio_t	_Sfstdin  = SFNEW(NULL,-1,0,(SFIO_READ |SFIO_STATIC),NULL);
 Sfio_t	_Sfstdout = SFNEW(NULL,-1,1,(SFIO_WRITE|SFIO_STATIC),NULL);
@@ -28,6 +28,40 @@
 **	Written by Kiem-Phong Vo
 */
 
+/*	Double the buffer of a read-only regular file that is being read
+**	sequentially, up to _Sfmaxbuf, so that bulk readers make fewer and
+**	larger read() calls. The first growth also asks the kernel for a
+**	wider readahead window.
+*/
+static void sfgrow(Sfio_t* f)
+{
+	Sfdisc_t*	disc;
+	uchar*		data;
+	ssize_t		size;
+
+	if(f->extent < 0 || f->extent-f->here <= f->size ||
+	   (f->flags&(SFIO_WRITE|SFIO_SHARE)) || !(f->flags&SFIO_MALLOC) )
+		return;
+	for(disc = f->disc; disc; disc = disc->disc)
+		if(disc->readf)
+			return;
+
+	if((size = 2*f->size) > _Sfmaxbuf)
+		size = _Sfmaxbuf;
+	/* keep a spare byte for callers that plant a sentinel past the data */
+	if(!(data = (uchar*)realloc(f->data,size+1)) )
+		return;
+	f->data = f->next = f->endb = f->endr = f->endw = data;
+	f->size = size;
+
+#if _lib_posix_fadvise && defined(POSIX_FADV_SEQUENTIAL)
+	if(!(f->bits&SFIO_ADVISED))
+	{	f->bits |= SFIO_ADVISED;
+		(void)posix_fadvise(f->file,0,0,POSIX_FADV_SEQUENTIAL);
+	}
+#endif
+}
+
 int _sffilbuf(Sfio_t*	f,	/* fill the read buffer of this stream */
 	      int	n)	/* see above */
 {
@@ -77,7 +111,11 @@ int _sffilbuf(Sfio_t*	f,	/* fill the read buffer of this stream */
 			}
 		}
 		else if(!(f->flags&SFIO_STRING) && !(f->bits&SFIO_MMAP) )
+		{	/* a full buffer consumed without seeking: read bigger chunks */
+			if(!justseek && f->size < _Sfmaxbuf && f->endb-f->data == f->size)
+				sfgrow(f);
 			f->next = f->endb = f->endr = f->data;
+		}
 
 		if(f->bits&SFIO_MMAP)
 			r = n > 0 ? n : f->size;
@@ -24,13 +24,24 @@
 **	Written by Kiem-Phong Vo
 */
 
+/* true if some discipline on the stream does its own reading */
+static int rdisc(Sfio_t* f)
+{
+	Sfdisc_t*	disc;
+
+	for(disc = f->disc; disc; disc = disc->disc)
+		if(disc->readf)
+			return 1;
+	return 0;
+}
+
 char* sfgetr(Sfio_t*	f,	/* stream to read from	*/
 	     int	rc,	/* record separator	*/
 	     int	type)
 {
 	ssize_t		n, un;
 	uchar		*s, *ends, *us;
-	int		found;
+	int		found, more, eof;
 	Sfrsrv_t*	rsrv;
 
 	if(!f || rc < 0 || (f->mode != SFIO_READ && _sfmode(f,SFIO_READ,0) < 0))
@@ -41,7 +52,7 @@ char* sfgetr(Sfio_t*	f,	/* stream to read from	*/
 	rsrv = NULL;
 	us = NULL;
 	un = 0;
-	found = 0;
+	found = more = eof = 0;
 
 	/* compatibility mode */
 	type = type < 0 ? SFIO_LASTR : type == 1 ? SFIO_STRING : type;
@@ -80,6 +91,7 @@ char* sfgetr(Sfio_t*	f,	/* stream to read from	*/
 			}
 		}
 
+	do_search:
 #if _lib_memchr
 		if(!(s = (uchar*)memchr((char*)s,rc,n)))
 			s = ends;
@@ -112,6 +124,26 @@ char* sfgetr(Sfio_t*	f,	/* stream to read from	*/
 			goto done;
 		}
 
+		/* a record straddling the end of the buffer: shift it to the
+		   front and read the rest in behind it rather than copying it
+		   aside; only the first piece of a record can take this route */
+		if(!found && !us)
+		{	if(!more)
+			{	more = 1;
+				f->straddle += 1;
+			}
+			if(n <= f->size/2 && !f->push && !(f->bits&SFIO_MMAP) &&
+			   !(f->extent < 0 && (f->flags&SFIO_SHARE)) && !rdisc(f) )
+			{	if(SFFILBUF(f,(int)f->size) > n)
+				{	s = f->next+n;
+					n = (ends = f->endb) - s;
+					goto do_search;
+				}
+				n = f->endb - f->next;
+				eof = 1;
+			}
+		}
+
 		/* get internal buffer */
 		if(!rsrv || rsrv->size < un+n+1)
 		{	if(rsrv)
@@ -130,6 +162,11 @@ char* sfgetr(Sfio_t*	f,	/* stream to read from	*/
 		ends = f->next;
 		f->next += n;
 		MEMCPY(s,ends,n);
+
+		if(eof) /* nothing more came in; keep the piece as the broken record */
+		{	us = NULL;
+			goto done;
+		}
 	}
 
 done:
@@ -134,6 +134,7 @@
 #define SFIO_ENDING	00000200	/* no re-io on interrupts at closing	*/
 #define SFIO_WIDE		00000400	/* in wide mode - stdio only		*/
 #define SFIO_PUTR		00001000	/* in sfputr()				*/
+#define SFIO_ADVISED	00002000	/* sequential access advised to kernel	*/
 
 /* "bits" flags that must be cleared in sfclrlock */
 #define SFIO_TMPBITS	00170000
@@ -375,6 +376,7 @@ struct _fmtpos_s
 #define SFFMT_MINUS	002000000000	/* minus sign			*/
 #define SFFMT_AFORMAT	004000000000	/* sfcvt converting %a		*/
 #define SFFMT_UPPER	010000000000	/* sfcvt converting upper	*/
+#define SFFMT_SHORTEST	000000000001	/* sfcvt shortest round trip	*/
 
 #define SFFMT_TYPES	(SFFMT_SHORT|SFFMT_SSHORT | SFFMT_LONG|SFFMT_LLONG|\
 			 SFFMT_LDOUBLE | SFFMT_IFLAG|SFFMT_JFLAG| \
@@ -606,6 +608,7 @@ typedef struct _sfextern_s
 #define SFIO_IDIGITS	1024		/* max number of digits in int part */
 #endif
 #define SFIO_MAXDIGITS	(((SFIO_FDIGITS+SFIO_IDIGITS)/sizeof(int) + 1)*sizeof(int))
+#define SFIO_DECDIG	800		/* max significant digits read exactly */
 
 /* tables for numerical translation */
 #define _Sfpos10	(_Sftable.sf_pos10)
@@ -659,52 +662,6 @@ typedef struct _sftab_
 /* thread-safe macro/function to initialize _Sfcv* conversion tables */
 #define SFCVINIT()      (_Sfcvinit ? 1 : (_Sfcvinit = (*_Sfcvinitf)()) )
 
-/* sfucvt() converts decimal integers to ASCII */
-#define SFDIGIT(v,scale,digit) \
-	{ if(v < 5*scale) \
-		if(v < 2*scale) \
-			if(v < 1*scale) \
-				{ digit = '0'; } \
-			else	{ digit = '1'; v -= 1*scale; } \
-		else	if(v < 3*scale) \
-				{ digit = '2'; v -= 2*scale; } \
-			else if(v < 4*scale) \
-				{ digit = '3'; v -= 3*scale; } \
-			else	{ digit = '4'; v -= 4*scale; } \
-	  else	if(v < 7*scale) \
-			if(v < 6*scale) \
-				{ digit = '5'; v -= 5*scale; } \
-			else	{ digit = '6'; v -= 6*scale; } \
-		else	if(v < 8*scale) \
-				{ digit = '7'; v -= 7*scale; } \
-			else if(v < 9*scale) \
-				{ digit = '8'; v -= 8*scale; } \
-			else	{ digit = '9'; v -= 9*scale; } \
-	}
-#define sfucvt(v,s,n,list,type,utype) \
-	{ while((utype)v >= 10000) \
-	  {	n = v; v = (type)(((utype)v)/10000); \
-		n = (type)((utype)n - ((utype)v)*10000); \
-	  	s -= 4; SFDIGIT(n,1000,s[0]); SFDIGIT(n,100,s[1]); \
-			s[2] = *(list = (char*)_Sfdec + (n <<= 1)); s[3] = *(list+1); \
-	  } \
-	  if(v < 100) \
-	  { if(v < 10) \
-	    { 	s -= 1; s[0] = (char)('0'+v); \
-	    } else \
-	    { 	s -= 2; s[0] = *(list = (char*)_Sfdec + (v <<= 1)); s[1] = *(list+1); \
-	    } \
-	  } else \
-	  { if(v < 1000) \
-	    { 	s -= 3; SFDIGIT(v,100,s[0]); \
-			s[1] = *(list = (char*)_Sfdec + (v <<= 1)); s[2] = *(list+1); \
-	    } else \
-	    {	s -= 4; SFDIGIT(v,1000,s[0]); SFDIGIT(v,100,s[1]); \
-			s[2] = *(list = (char*)_Sfdec + (v <<= 1)); s[3] = *(list+1); \
-	    } \
-	  } \
-	}
-
 /* handy functions */
 #undef min
 #undef max
@@ -758,6 +715,8 @@ extern int		_sfexcept(Sfio_t*, int, ssize_t, Sfdisc_t*);
 extern Sfrsrv_t*	_sfrsrv(Sfio_t*, ssize_t);
 extern int		_sfsetpool(Sfio_t*);
 extern char*		_sfcvt(void*,char*,size_t,int,int*,int*,int*,int);
+extern int		_sfdtoa(Sfdouble_t,int,int,int,char*,int,int*);
+extern Sfdouble_t	_sfdtof(const char*,int,int,int);
 extern char**		_sfgetpath(char*);
 
 extern Sfextern_t	_Sfextern;
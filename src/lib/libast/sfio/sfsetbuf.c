@@ -57,6 +57,7 @@ static int sfsetlinemode(void)
 	static int		modes = -1;
 	static const char	sf_line[] = "SFIO_LINE";
 	static const char	sf_maxr[] = "SFIO_MAXR=";
+	static const char	sf_maxbuf[] = "SFIO_MAXBUF=";
 	static const char	sf_wcwidth[] = "SFIO_WCWIDTH";
 
 #define ISSEPAR(c)	((c) == ',' || (c) == ' ' || (c) == '\t')
@@ -74,6 +75,9 @@ static int sfsetlinemode(void)
 				else if((endw-astsfio) > (sizeof(sf_maxr)-1) &&
 				   strncmp(astsfio,sf_maxr,sizeof(sf_maxr)-1) == 0)
 					_Sfmaxr = (ssize_t)strtonll(astsfio+sizeof(sf_maxr)-1,NULL,NULL,0);
+				else if((endw-astsfio) > (sizeof(sf_maxbuf)-1) &&
+				   strncmp(astsfio,sf_maxbuf,sizeof(sf_maxbuf)-1) == 0)
+					_Sfmaxbuf = (ssize_t)strtonll(astsfio+sizeof(sf_maxbuf)-1,NULL,NULL,0);
 				else if((endw-astsfio) > (sizeof(sf_wcwidth)-1) &&
 				   strncmp(astsfio,sf_wcwidth,sizeof(sf_wcwidth)-1) == 0)
 					modes |= SFIO_WCWIDTH;
@@ -0,0 +1,25 @@
+/***********************************************************************
+*                                                                      *
+*               This software is part of the ast package               *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
+*                      and is licensed under the                       *
+*                 Eclipse Public License, Version 2.0                  *
+*                                                                      *
+*                A copy of the License is available at                 *
+*      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      *
+*         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         *
+*                                                                      *
+*                  Martijn Dekker <martijn@inlv.org>                   *
+*                                                                      *
+***********************************************************************/
+#include	"sfhdr.h"
+
+/*	Return the number of records that sfgetr() found split across
+**	the end of the buffer of f, so that more data had to be read
+**	before the record separator turned up.
+*/
+
+size_t sfstraddle(Sfio_t* f)
+{
+	return f ? f->straddle : 0;
+}
@@ -54,9 +54,6 @@
 #define S2F_static	1
 #define S2F_type	2
 #define S2F_scan	1
-#ifndef elementsof
-#define elementsof(a)	(sizeof(a)/sizeof(a[0]))
-#endif
 #endif
 
 #if S2F_type == 2 && _ast_fltmax_double
@@ -66,6 +63,8 @@
 
 #if S2F_type == 0
 #define S2F_number	float
+#define S2F_mant	(FLT_MANT_DIG)
+#define S2F_exact	10
 #define S2F_ldexp	ldexp
 #define S2F_pow10	_Sffpow10
 #define S2F_inf		_Sffinf
@@ -79,6 +78,8 @@
 #endif
 #if S2F_type == 1
 #define S2F_number	double
+#define S2F_mant	(DBL_MANT_DIG)
+#define S2F_exact	22
 #define S2F_ldexp	ldexp
 #define S2F_pow10	_Sfdpow10
 #define S2F_inf		_Sfdinf
@@ -92,6 +93,14 @@
 #endif
 #if S2F_type == 2
 #define S2F_number	long double
+#define S2F_mant	(LDBL_MANT_DIG)
+#if LDBL_MANT_DIG >= 113
+#define S2F_exact	48
+#elif LDBL_MANT_DIG >= 64
+#define S2F_exact	27
+#else
+#define S2F_exact	22
+#endif
 #define S2F_ldexp	ldexpl
 #define S2F_pow10	_Sflpow10
 #define S2F_inf		_Sflinf
@@ -112,6 +121,32 @@
 
 #define S2F_batch	_ast_flt_unsigned_max_t
 
+/*
+ * Clinger's fast path: an integer and a power of 10 that are both exact
+ * in S2F_number give a correctly rounded product or quotient, provided
+ * the arithmetic is not done in a wider type and rounded twice
+ */
+
+#if S2F_type == 2 || defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+#define S2F_fast	19
+#else
+#define S2F_fast	0
+#endif
+#if S2F_mant >= 64
+#define S2F_exact_int(n)	1
+#else
+#define S2F_exact_int(n)	((n) <= ((S2F_batch)1 << S2F_mant))
+#endif
+
+/*
+ * failing that, the same in a wider Sfdouble_t rounds correctly to
+ * S2F_number unless it lands on a midpoint between two S2F_number values
+ */
+
+#if S2F_type < 2 && !_ast_fltmax_double && LDBL_MANT_DIG >= 64
+#define S2F_wide	27
+#endif
+
 #undef	ERR		/* who co-opted this namespace? */
 
 #if S2F_scan
@@ -144,12 +179,6 @@ typedef int (*S2F_get_f)(void*, int);
 
 #endif
 
-typedef struct S2F_part_s
-{
-	S2F_batch	batch;
-	int		digits;
-} S2F_part_t;
-
 #if !defined(ERANGE)
 #define ERANGE		EINVAL
 #endif
@@ -187,12 +216,20 @@ S2F_function(const char* str, char** end)
 	int		fraction;
 	int		decimal = 0;
 	int		thousand = 0;
-	int		part = 0;
-	int		back_part = 0;
+	int		part;
+	int		nd = 0;
+	int		lead = 0;
+	int		more = 0;
+	int		back_nd = 0;
+	int		back_more = 0;
+	int		back_digits = 0;
 	S2F_batch	back_n = 0;
 	S2F_number	v;
-	S2F_number	p;
-	S2F_part_t	parts[16];
+	Sfdouble_t	x;
+#ifdef S2F_wide
+	Sfdouble_t	y;
+#endif
+	char		dig[SFIO_DECDIG+1];
 
 	/*
 	 * radix char and thousands separator are locale specific
@@ -372,14 +409,21 @@ S2F_function(const char* str, char** end)
 	{
 		if (c >= '0' && c <= '9')
 		{
+			/*
+			 * keep the significant digits, past SFIO_DECDIG
+			 * only note whether any of the rest is nonzero
+			 */
+
 			digits++;
-			n = (n << 3) + (n << 1) + (c - '0');
-			if (n >= ((~((S2F_batch)0)) / 10) && part < elementsof(parts))
+			if (nd >= SFIO_DECDIG)
+				more |= c != '0';
+			else if (nd || c != '0')
 			{
-				parts[part].batch = n;
-				n = 0;
-				parts[part].digits = digits;
-				part++;
+				if (!nd)
+					lead = digits - 1;
+				if (nd < S2F_fast)
+					n = (n << 3) + (n << 1) + (c - '0');
+				dig[nd++] = c;
 			}
 		}
 		else if (m && (digits - m) != 3)
@@ -402,7 +446,9 @@ S2F_function(const char* str, char** end)
 		{
 			SET(s, t, b);
 			back_n = n;
-			back_part = part;
+			back_nd = nd;
+			back_more = more;
+			back_digits = digits;
 		}
 		c = GET(s);
 	}
@@ -410,18 +456,9 @@ S2F_function(const char* str, char** end)
 	{
 		REV(s, t, b);
 		n = back_n;
-		part = back_part;
-	}
-
-	/*
-	 * don't forget the last part
-	 */
-
-	if (n && part < elementsof(parts))
-	{
-		parts[part].batch = n;
-		parts[part].digits = digits;
-		part++;
+		nd = back_nd;
+		more = back_more;
+		digits = back_digits;
 	}
 
 	/*
@@ -435,16 +472,17 @@ S2F_function(const char* str, char** end)
 		c = GET(s);
 		if ((enegative = (c == '-')) || c == '+')
 			c = GET(s);
-		n = 0;
+		m = 0;
 		while (c >= '0' && c <= '9')
 		{
-			n = (n << 3) + (n << 1) + (c - '0');
+			if (m < 100000)
+				m = (m << 3) + (m << 1) + (c - '0');
 			c = GET(s);
 		}
 		if (enegative)
-			digits -= n;
+			digits -= m;
 		else
-			digits += n;
+			digits += m;
 	}
 
 #if S2F_qualifier
@@ -466,59 +504,50 @@ S2F_function(const char* str, char** end)
 	PUT(s);
 
 	/*
-	 * adjust for at most one multiply per part
-	 * and at most one divide overall
+	 * the value is the integer in dig[] times 10^m
 	 */
 
 	v = 0;
-	if (!part)
+	if (!nd)
 		return negative ? -v : v;
-	else if ((m = parts[part-1].digits - digits) > 0)
-		digits += m;
-	else
-		m = 0;
-
-	/*
-	 * combine the parts
-	 */
-
-	while (part--)
+	if (more)
+		dig[nd++] = '1';
+	m = digits - lead - nd;
+	if (nd <= S2F_fast && m >= -S2F_exact && m <= S2F_exact && S2F_exact_int(n))
 	{
-		p = parts[part].batch;
-		c = digits - parts[part].digits;
-		if (c > S2F_exp_10_max)
-		{
-			ERR(ERANGE);
-			return negative ? -S2F_inf : S2F_inf;
-		}
-		if (c > 0)
-		{
-#if _ast_mpy_overflow_fpe
-			if ((S2F_max / p) < S2F_pow10[c])
-			{
-				ERR(ERANGE);
-				return negative ? -S2F_inf : S2F_inf;
-			}
-#endif
-			p *= S2F_pow10[c];
-		}
-		v += p;
+		v = n;
+		if (m > 0)
+			v *= S2F_pow10[m];
+		else if (m < 0)
+			v /= S2F_pow10[-m];
 	}
-	if (m)
+	else
 	{
-		while (m > S2F_exp_10_max)
+#ifdef S2F_wide
+		if (nd <= 19 && m >= -S2F_wide && m <= S2F_wide)
 		{
-			m -= S2F_exp_10_max;
-			v /= S2F_pow10[S2F_exp_10_max];
+			x = n;
+			if (m > 0)
+				x *= _Sflpow10[m];
+			else if (m < 0)
+				x /= _Sflpow10[-m];
+			v = x;
+			if (!(y = x - v) || (S2F_number)(v + 2 * y) != v + 2 * y)
+				goto check;
 		}
-#if _ast_div_underflow_fpe
-		if ((S2F_min * p) > S2F_pow10[c])
+#endif
+
+		/*
+		 * round the exact value
+		 */
+
+		x = _sfdtof(dig, nd, m, S2F_mant);
+		if (x > S2F_max)
 		{
 			ERR(ERANGE);
 			return negative ? -S2F_inf : S2F_inf;
 		}
-#endif
-		v /= S2F_pow10[m];
+		v = x;
 	}
 
 	/*
@@ -66,6 +66,80 @@ static int chr2str(char* buf, int v)
 	}
 }
 
+/*	Check if a format has nothing but literal text, %% and plain %s, %d, %i
+**	and %u conversions, the integer ones with an optional l, ll, j or z size.
+**	Such formats are handled by a fast path in sfvprintf().
+*/
+static int fmtsimple(const char* form)
+{
+	int	wide = mbwide();
+
+	for(; *form; ++form)
+	{	if(*form != '%')
+		{	/* only the general engine steps over multibyte characters */
+			if(wide && (*form&0x80))
+				return 0;
+			continue;
+		}
+		switch(*++form)
+		{
+		case '%':
+		case 's':
+			continue;
+		case 'l':
+			if(*++form == 'l')
+				++form;
+			break;
+		case 'j':
+		case 'z':
+			++form;
+			break;
+		}
+		if(*form != 'd' && *form != 'i' && *form != 'u')
+			return 0;
+	}
+	return 1;
+}
+
+/*	Convert v to decimal digits ending at e, two digits at a time.
+**	Above 32 bits, 8 digits are split off at a time so that most of the
+**	divisions are done in 32-bit arithmetic. Return the start of the digits.
+*/
+static char* fmtdec(char* e, Sfulong_t v)
+{
+	Sfulong_t	q;
+	uint32_t	m, p;
+	int		i, r;
+
+	while(v > 0xffffffff)
+	{	q = v/100000000;
+		m = (uint32_t)(v - q*100000000);
+		for(i = 0; i < 4; i++)
+		{	p = m/100;
+			r = (int)(m - p*100) << 1;
+			*--e = _Sfdec[r+1];
+			*--e = _Sfdec[r];
+			m = p;
+		}
+		v = q;
+	}
+	m = (uint32_t)v;
+	while(m >= 100)
+	{	p = m/100;
+		r = (int)(m - p*100) << 1;
+		*--e = _Sfdec[r+1];
+		*--e = _Sfdec[r];
+		m = p;
+	}
+	if(m >= 10)
+	{	r = (int)m << 1;
+		*--e = _Sfdec[r+1];
+		*--e = _Sfdec[r];
+	}
+	else	*--e = (char)('0' + m);
+	return e;
+}
+
 /* On some platform(s), large functions are not compilable.
 ** In such a case, the below macro should be defined non-zero so that
 ** some in-lined macros will be made smaller, trading time for space.
@@ -131,6 +205,7 @@ int sfvprintf(Sfio_t*		f,		/* file to print to	*/
 #define SFputc(f,c)	SMputc(f,c)
 #define SFnputc(f,c,n)	SMnputc(f,c,n)
 #define SFwrite(f,s,n)	SMwrite(f,s,n)
+#define SFcopy(f,s,n)	SMwrite(f,s,n)
 #else
 	uchar	*d, *endd;
 #define SFBUF(f)	(d = f->next, endd = f->endb)
@@ -145,6 +220,9 @@ int sfvprintf(Sfio_t*		f,		/* file to print to	*/
 #define SFwrite(f,s,n)	{ if(d+n <= endd) { while(n--) *d++ = (uchar)(*s++); } \
 			  else 		  { SFEND(f); SMwrite(f,s,n); SFBUF(f); } \
 			}
+#define SFcopy(f,s,n)	{ if(d+n <= endd) { memcpy(d,s,n); d += n; } \
+			  else 		  { SFEND(f); SMwrite(f,s,n); SFBUF(f); } \
+			}
 #endif /* _sffmt_small */
 
 
@@ -177,6 +255,62 @@ int sfvprintf(Sfio_t*		f,		/* file to print to	*/
 
 	nargs = xargs = -1;
 
+	/* formats with only plain %s and decimal conversions skip the engine */
+	if(fmtsimple(form))
+	{	for(;;)
+		{	for(sp = (char*)form; *form && *form != '%'; ++form)
+				;
+			if((n = form-sp) > 0)
+				SFcopy(f,sp,n);
+			if(!*form)
+				goto done;
+			size = sizeof(int);
+			switch(*++form)
+			{
+			case '%':
+				SFputc(f,'%');
+				++form;
+				continue;
+			case 's':
+				if(!(sp = va_arg(args,char*)))
+					sp = "(null)";
+				n = strlen(sp);
+				SFcopy(f,sp,n);
+				++form;
+				continue;
+			case 'l':
+				size = sizeof(long);
+				if(*++form == 'l')
+				{	size = sizeof(Sflong_t);
+					++form;
+				}
+				break;
+			case 'j':
+				size = sizeof(Sflong_t);
+				++form;
+				break;
+			case 'z':
+				size = sizeof(size_t);
+				++form;
+				break;
+			}
+			fmt = *form++;
+			if(size == sizeof(int))
+				lv = fmt == 'u' ? (Sflong_t)va_arg(args,uint) : (Sflong_t)va_arg(args,int);
+			else if(size == sizeof(long))
+				lv = fmt == 'u' ? (Sflong_t)va_arg(args,ulong) : (Sflong_t)va_arg(args,long);
+			else	lv = va_arg(args,Sflong_t);
+			endsp = buf+sizeof(buf);
+			if(fmt != 'u' && lv < 0)
+			{	sp = fmtdec(endsp,-(Sfulong_t)lv);
+				*--sp = '-';
+			}
+			else	sp = fmtdec(endsp,(Sfulong_t)lv);
+			n = endsp-sp;
+			SFcopy(f,sp,n);
+		}
+	}
+
 loop_fmt :
 	SFMBCLR(&fmbs); /* clear multibyte states to parse the format string */
 	while((n = *form) )
@@ -1009,9 +1143,7 @@ loop_fmt :
 					else	lv = -lv;
 				}
 				if(n_s < 0)	/* base 10 */
-				{	Sflong_t	nv;
-					sfucvt(lv,sp,nv,ssp,Sflong_t,Sfulong_t);
-				}
+					sp = fmtdec(sp,(Sfulong_t)lv);
 				else if(n_s > 0) /* base power-of-2 */
 				{	do
 					{	*--sp = ssp[lv&n_s];
@@ -1067,8 +1199,7 @@ loop_fmt :
 					else	v = -v;
 				}
 				if(n_s < 0)	/* base 10 */
-				{	sfucvt(v,sp,n,ssp,int,uint);
-				}
+					sp = fmtdec(sp,(uint)v);
 				else if(n_s > 0) /* base power-of-2 */
 				{	do
 					{	*--sp = ssp[v&n_s];
@@ -1159,9 +1290,16 @@ loop_fmt :
 
 			if(fmt == 'e' || fmt == 'E' && (v |= SFFMT_UPPER))
 			{	v |= SFFMT_EFORMAT;
+				if(flags&SFFMT_CHOP)
+				{	/* %.-e: shortest digits that read back the same */
+					v |= SFFMT_SHORTEST;
+					precis = 0;
+				}
 				n = (precis = precis < 0 ? FPRECIS : precis)+1;
 				ep = _sfcvt(valp,tmp+1,sizeof(tmp)-1, min(n,SFIO_FDIGITS),
 					    &decpt, &sign, &n_s, v);
+				if(v & SFFMT_SHORTEST)
+					precis = n_s - 1;
 				goto e_format;
 			}
 			else if(fmt == 'f' || fmt == 'F' && (v |= SFFMT_UPPER))
@@ -1191,7 +1329,12 @@ loop_fmt :
 				goto a_format;
 			}
 			else /* 'g' or 'G' format */
-			{	precis = precis < 0 ? FPRECIS : precis == 0 ? 1 : precis;
+			{	if(flags&SFFMT_CHOP)
+				{	/* %.-g: shortest digits that read back the same */
+					v |= SFFMT_SHORTEST;
+					precis = (v&SFFMT_LDOUBLE) ? LDBL_DIG : DBL_DIG;
+				}
+				precis = precis < 0 ? FPRECIS : precis == 0 ? 1 : precis;
 				if(fmt == 'G')
 					v |= SFFMT_UPPER;
 				v |= SFFMT_EFORMAT;
@@ -1204,13 +1347,13 @@ loop_fmt :
 
 				if(!(flags&SFFMT_ALTER))
 				{	/* zap trailing 0s */
-					if((n = n_s) > precis)
+					if((n = n_s) > precis && !(v&SFFMT_SHORTEST))
 						n = precis;
 					while((n -= 1) >= 1 && ep[n] == '0')
 						;
 					n += 1;
 				}
-				else	n = precis;
+				else	n = (v&SFFMT_SHORTEST) && n_s > precis ? n_s : precis;
 
 				if(decpt < -3 || decpt > precis)
 				{	precis = n-1;
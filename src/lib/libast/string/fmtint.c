@@ -78,11 +78,31 @@ static const char table[]=
 	"980981982983984985986987988989990991992993994995996997998999"
 };
 
+/*
+ * the 9 digits of m < 1000000000 before e, in 32-bit arithmetic
+ */
+
+static char*
+fmt9(char* e, uint32_t m)
+{
+	uint32_t	q;
+	int		i;
+
+	for(i = 0; i < 3; i++)
+	{
+		q = m / 1000;
+		memcpy(e -= 3, table + 3 * (m - q * 1000), 3);
+		m = q;
+	}
+	return e;
+}
+
 char*
 fmtint(intmax_t ll, int unsign)
 {
 	char		*buff;
-	uintmax_t	n,m;
+	uintmax_t	n;
+	uint32_t	m, q;
 	int		j=0,k=3*sizeof(ll);
 	if(unsign || ll>=0)
 		n = ll;
@@ -100,15 +120,21 @@ fmtint(intmax_t ll, int unsign)
 	}
 	buff = fmtbuf(k);
 	buff[--k] = 0;
+	/* 64-bit division only for the chunks of 9 digits above the low 32 bits */
+	while(n >= 1000000000)
+	{
+		k = fmt9(buff + k, (uint32_t)(n % 1000000000)) - buff;
+		n /= 1000000000;
+	}
+	m = (uint32_t)n;
 	do
 	{
 		k -= 3;
-		if((m=n) >= 1000)
-			m = n%1000;
-		memcpy(buff+k,table+3*m,3);
-		n /= 1000;
+		q = m / 1000;
+		memcpy(buff+k,table+3*(m-q*1000),3);
+		m = q;
 	}
-	while(n>0);
+	while(m>0);
 	while(buff[k]=='0')
 		k++;
 skip:
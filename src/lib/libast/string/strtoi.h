@@ -111,6 +111,45 @@
 #define ADDOVER(n,c,s)	((S2I_umax-(n))<((S2I_unumber)((c)+(s))))
 #define MPYOVER(n,c)	(((S2I_unumber)(n))>(S2I_umax/(c)))
 
+/*
+ * eight ASCII decimal digits at a time, SWAR style: S2I_digits8(s) loads
+ * s[0..7] into w if they are all digits, s2i_swar(w) is their value, and
+ * no overflow is possible while n <= S2I_swar_max
+ */
+
+#define S2I_swar_max	((S2I_umax - 100000000) / 100000000)
+
+static uint64_t
+s2i_load8(const unsigned char* s)
+{
+	return (uint64_t)s[0] | (uint64_t)s[1] << 8 | (uint64_t)s[2] << 16 | (uint64_t)s[3] << 24 |
+	       (uint64_t)s[4] << 32 | (uint64_t)s[5] << 40 | (uint64_t)s[6] << 48 | (uint64_t)s[7] << 56;
+}
+
+static uint32_t
+s2i_swar(uint64_t w)
+{
+	w = ((w & 0x0f0f0f0f0f0f0f0f) * 2561) >> 8;
+	w = ((w & 0x00ff00ff00ff00ff) * 6553601) >> 16;
+	return (uint32_t)(((w & 0x0000ffff0000ffff) * 42949672960001) >> 32);
+}
+
+#define S2I_digit(c)	((unsigned int)((c) - '0') <= 9)
+
+#if S2I_size
+static int
+s2i_digits8(uint64_t w)
+{
+	return ((w & 0xf0f0f0f0f0f0f0f0) | (((w + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0) >> 4)) == 0x3333333333333333;
+}
+#define S2I_digits8(s)	(S2I_valid((s)+7) && s2i_digits8(w = s2i_load8(s)))
+#else
+/* stop at the terminating 0 rather than read past it */
+#define S2I_digits8(s)	(S2I_digit((s)[0]) && S2I_digit((s)[1]) && S2I_digit((s)[2]) && S2I_digit((s)[3]) && \
+			 S2I_digit((s)[4]) && S2I_digit((s)[5]) && S2I_digit((s)[6]) && S2I_digit((s)[7]) && \
+			 (w = s2i_load8(s), 1))
+#endif
+
 static const S2I_unumber	mm[] =
 {
 	0,
@@ -208,6 +247,8 @@ S2I_function(const char* a, char** e, int base)
 	unsigned char*	b;
 	unsigned char*	k;
 	S2I_unumber	v = 0;
+	unsigned char*	q;
+	uint64_t	w;
 #if S2I_multiplier
 	int		base;
 #endif
@@ -310,6 +351,19 @@ S2I_function(const char* a, char** e, int base)
 	{
 		b = s;
 		p = 0;
+		/*
+		 * the first eight digits are taken a byte at a time, so that short
+		 * numbers cost no more than before; only a number that has all of
+		 * them goes on to the eight-digit steps
+		 */
+		for (q = s + 8; s < q && S2I_valid(s) && S2I_digit(*s); s++)
+			n = (n << 3) + (n << 1) + (*s - '0');
+		if (s == q)
+			while (n <= S2I_swar_max && S2I_digits8(s))
+			{
+				n = n * 100000000 + s2i_swar(w);
+				s += 8;
+			}
 		for (;;)
 		{
 			if (S2I_valid(s) && (c = *s++) >= '0' && c <= '9')
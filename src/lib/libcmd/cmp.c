@@ -2,7 +2,7 @@
 *                                                                      *
 *               This software is part of the ast package               *
 *          Copyright (c) 1992-2012 AT&T Intellectual Property          *
-*          Copyright (c) 2020-2024 Contributors to ksh 93u+m           *
+*          Copyright (c) 2020-2026 Contributors to ksh 93u+m           *
 *                      and is licensed under the                       *
 *                 Eclipse Public License, Version 2.0                  *
 *                                                                      *
@@ -25,7 +25,7 @@
  */
 
 static const char usage[] =
-"[-?\n@(#)$Id: cmp (AT&T Research) 2010-04-11 $\n]"
+"[-?\n@(#)$Id: cmp (ksh 93u+m) 2026-10-18 $\n]"
 "[--catalog?" ERROR_CATALOG "]"
 "[+NAME?cmp - compare two files]"
 "[+DESCRIPTION?\bcmp\b compares two files \afile1\a and \afile2\a. "
@@ -76,12 +76,23 @@ static const char usage[] =
 #include <ls.h>
 #include <ctype.h>
 #include <ccode.h>
+#include <range.h>
 
 #define CMP_VERBOSE	0x01
 #define CMP_SILENT	0x02
 #define CMP_CHARS	0x04
 #define CMP_BYTES	0x08
 
+#define CMP_BLOCK	4096			/* memcmp() block size		*/
+#define CMP_WINSIZE	(1024*1024)		/* pread() window size		*/
+
+typedef struct Win_s			/* pread() window on a regular file	*/
+{
+	unsigned char*	buf;			/* window buffer or 0		*/
+	Sfoff_t		offset;			/* next offset to read		*/
+	int		fd;			/* file descriptor, <0 for sfio	*/
+} Win_t;
+
 static void
 pretty(Sfio_t *out, int o, int delim, int flags)
 {
@@ -134,12 +145,85 @@ pretty(Sfio_t *out, int o, int delim, int flags)
 	sfputr(out, buf, delim);
 }
 
+/*
+ * return the offset of the first byte that differs in p1 and p2, or n if none;
+ * memcmp() is vectorized by the C library, so it is used on whole blocks
+ * and the byte loop only runs in the first block that differs
+ */
+
+static size_t
+mismatch(const unsigned char* p1, const unsigned char* p2, size_t n)
+{
+	size_t	i = 0;
+	size_t	m;
+
+	while (i < n)
+	{
+		m = n - i;
+		if (m > CMP_BLOCK)
+			m = CMP_BLOCK;
+		if (memcmp(p1 + i, p2 + i, m))
+			break;
+		i += m;
+	}
+	while (i < n && p1[i] == p2[i])
+		i++;
+	return i;
+}
+
+static void
+unwin(Win_t* wp)
+{
+	free(wp->buf);
+	wp->buf = 0;
+	wp->fd = -1;
+}
+
+/*
+ * return the next block of f and set *n to its size;
+ * if wp->fd >= 0 then the block is the next pread() window of the file,
+ * and if that fails the rest is read with sfio, which reports the error;
+ * unlike mmap(), pread() on a file truncated meanwhile just comes up short
+ */
+
+static unsigned char*
+next(Sfio_t* f, Win_t* wp, int* n)
+{
+	unsigned char*	p;
+	ssize_t		r;
+
+	if (wp->fd >= 0)
+	{
+		if (wp->buf || (wp->buf = newof(0, unsigned char, CMP_WINSIZE, 0)))
+		{
+			while ((r = pread(wp->fd, wp->buf, CMP_WINSIZE, wp->offset)) < 0 && errno == EINTR);
+			if (r >= 0)
+			{
+				wp->offset += r;
+				*n = (int)r;
+				return r ? wp->buf : 0;
+			}
+		}
+		wp->fd = -1;
+		if (sfseek(f, wp->offset, SEEK_SET) != wp->offset)
+		{
+			*n = 0;
+			return 0;
+		}
+	}
+	if (p = (unsigned char*)sfreserve(f, SFIO_UNBOUND, 0))
+		*n = sfvalue(f);
+	else
+		*n = 0;
+	return p;
+}
+
 /*
  * compare two files
  */
 
 static int
-cmp(const char* file1, Sfio_t* f1, const char* file2, Sfio_t* f2, int flags, Sfoff_t count, Sfoff_t differences)
+cmp(const char* file1, Sfio_t* f1, Win_t* w1, const char* file2, Sfio_t* f2, Win_t* w2, int flags, Sfoff_t count, Sfoff_t differences)
 {
 	int		c1;
 	int		c2;
@@ -151,6 +235,7 @@ cmp(const char* file1, Sfio_t* f1, const char* file2, Sfio_t* f2, int flags, Sfo
 	Sfoff_t		pos = 0;
 	int		n1 = 0;
 	int		ret = 0;
+	size_t		d;
 	unsigned char*	last;
 
 	for (;;)
@@ -159,14 +244,14 @@ cmp(const char* file1, Sfio_t* f1, const char* file2, Sfio_t* f2, int flags, Sfo
 		{
 			if (count > 0 && !(count -= n1))
 				return ret;
-			if (!(p1 = (unsigned char*)sfreserve(f1, SFIO_UNBOUND, 0)) || (c1 = sfvalue(f1)) <= 0)
+			if (!(p1 = next(f1, w1, &c1)) || c1 <= 0)
 			{
 				if (sferror(f1))
 				{
 					error(ERROR_exit(2), "read error on %s", file1);
 					UNREACHABLE();
 				}
-				if ((e2 - p2) > 0 || sfreserve(f2, SFIO_UNBOUND, 0) && sfvalue(f2) > 0)
+				if ((e2 - p2) > 0 || next(f2, w2, &c2) && c2 > 0)
 				{
 					ret = 1;
 					if (!(flags & CMP_SILENT))
@@ -189,7 +274,7 @@ cmp(const char* file1, Sfio_t* f1, const char* file2, Sfio_t* f2, int flags, Sfo
 		}
 		if ((c2 = e2 - p2) <= 0)
 		{
-			if (!(p2 = (unsigned char*)sfreserve(f2, SFIO_UNBOUND, 0)) || (c2 = sfvalue(f2)) <= 0)
+			if (!(p2 = next(f2, w2, &c2)) || c2 <= 0)
 			{
 				if (sferror(f2))
 				{
@@ -220,6 +305,13 @@ cmp(const char* file1, Sfio_t* f1, const char* file2, Sfio_t* f2, int flags, Sfo
 			last = p1 + c1;
 			while (p1 < last)
 			{
+				d = mismatch(p1, p2, last - p1);
+				if (!(flags & CMP_VERBOSE))
+					lines += range_count(p1, d, '\n');
+				p1 += d;
+				p2 += d;
+				if (p1 >= last)
+					break;
 				if ((c1 = *p1++) != *p2++)
 				{
 					if (differences >= 0)
@@ -261,6 +353,7 @@ b_cmp(int argc, char** argv, Shbltin_t* context)
 	int		n;
 	struct stat	s1;
 	struct stat	s2;
+	Win_t*		wp;
 
 	Sfio_t*		f1 = 0;
 	Sfio_t*		f2 = 0;
@@ -270,8 +363,17 @@ b_cmp(int argc, char** argv, Shbltin_t* context)
 	Sfoff_t		differences = -1;
 	int		flags = 0;
 
-	NoP(argc);
-	cmdinit(argc, argv, context, ERROR_CATALOG, 0);
+	if (argc <= 0)
+	{
+		if (context && (wp = (Win_t*)sh_context(context)->data))
+		{
+			sh_context(context)->data = 0;
+			unwin(&wp[0]);
+			unwin(&wp[1]);
+		}
+		return 0;
+	}
+	cmdinit(argc, argv, context, ERROR_CATALOG, ERROR_CALLBACK);
 	for (;;)
 	{
 		switch (optget(argv, usage))
@@ -382,8 +484,31 @@ b_cmp(int argc, char** argv, Shbltin_t* context)
 		error(ERROR_system(0), "%s: cannot stat", file1);
 	else if (s1.st_ino == s2.st_ino && s1.st_dev == s2.st_dev && o1 == o2)
 		n = 0;
+	else if ((flags & CMP_SILENT) && S_ISREG(s1.st_mode) && S_ISREG(s2.st_mode) && (s1.st_size - o1) != (s2.st_size - o2))
+		n = 1;
+	else if (!(wp = stkalloc(stkstd, 2 * sizeof(Win_t))))
+	{
+		error(ERROR_SYSTEM|ERROR_PANIC, "out of memory");
+		UNREACHABLE();
+	}
 	else
-		n = ((flags & CMP_SILENT) && S_ISREG(s1.st_mode) && S_ISREG(s2.st_mode) && (s1.st_size - o1) != (s2.st_size - o2)) ? 1 : cmp(file1, f1, file2, f2, flags, count, differences);
+	{
+		memset(wp, 0, 2 * sizeof(Win_t));
+		wp[0].fd = wp[1].fd = -1;
+		/* read regular files in large windows rather than through sfio buffers */
+		if (S_ISREG(s1.st_mode) && S_ISREG(s2.st_mode) && f1 != sfstdin && f2 != sfstdin && (wp[0].offset = sftell(f1)) >= 0 && (wp[1].offset = sftell(f2)) >= 0)
+		{
+			wp[0].fd = sffileno(f1);
+			wp[1].fd = sffileno(f2);
+			if (context)
+				sh_context(context)->data = (void*)wp;
+		}
+		n = cmp(file1, f1, &wp[0], file2, f2, &wp[1], flags, count, differences);
+		if (context)
+			sh_context(context)->data = 0;
+		unwin(&wp[0]);
+		unwin(&wp[1]);
+	}
  done:
 	if (f1 && f1 != sfstdin)
 		sfclose(f1);
@@ -24,7 +24,7 @@
  */
 
 static const char usage[] =
-"[-?\n@(#)$Id: comm (AT&T Research) 1999-04-28 $\n]"
+"[-?\n@(#)$Id: comm (ksh 93u+m) 2026-10-18 $\n]"
 "[--catalog?" ERROR_CATALOG "]"
 "[+NAME?comm - select or reject lines common to two files]"
 "[+DESCRIPTION?\bcomm\b reads two files \afile1\a and \afile2\a "
@@ -60,10 +60,69 @@ static const char usage[] =
 #define C_COMMON	4
 #define C_ALL		(C_FILE1|C_FILE2|C_COMMON)
 
+#define C_BLOCK		4096	/* memcmp() block size */
+
+/*
+ * once the files agree on a run of lines, compare whole buffers
+ * instead of line by line: memcmp() is vectorized by the C library,
+ * so find the common prefix a block at a time, then back up to the
+ * last newline and copy or skip that many bytes of both streams
+ * returns the number of bytes consumed from each, -1 on write error
+ */
+static ssize_t same(Sfio_t *in1, Sfio_t *in2, Sfio_t *out, int mode)
+{
+	char *b1, *b2, *cp, *ep;
+	ssize_t i=0, n, m;
+	if(in1==in2 || !(b1 = sfreserve(in1,SFIO_UNBOUND,SFIO_LOCKR)))
+		return 0;
+	n = sfvalue(in1);
+	if(!(b2 = sfreserve(in2,SFIO_UNBOUND,SFIO_LOCKR)))
+	{
+		sfread(in1,b1,0);
+		return 0;
+	}
+	if(sfvalue(in2) < n)
+		n = sfvalue(in2);
+	while(i<n)
+	{
+		m = (n-i<C_BLOCK?n-i:C_BLOCK);
+		if(memcmp(b1+i,b2+i,m))
+			break;
+		i += m;
+	}
+	while(i<n && b1[i]==b2[i])
+		i++;
+	while(i>0 && b1[i-1]!='\n')
+		i--;
+	if(i>0 && (mode&C_COMMON))
+	{
+		if(mode==C_COMMON)
+		{
+			if(sfwrite(out,b1,i) < 0)
+				i = -1;
+		}
+		else for(cp=b1,ep=b1+i; cp<ep; cp+=m)
+		{
+			m = (char*)memchr(cp,'\n',ep-cp) + 1 - cp;
+			sfputc(out,'\t');
+			if(mode==C_ALL)
+				sfputc(out,'\t');
+			if(sfwrite(out,cp,m) < 0)
+			{
+				i = -1;
+				break;
+			}
+		}
+	}
+	sfread(in1,b1,i>0?i:0);
+	sfread(in2,b2,i>0?i:0);
+	return i;
+}
+
 static int comm(Sfio_t *in1, Sfio_t *in2, Sfio_t *out,int mode)
 {
 	char *cp1, *cp2;
-	int n1 = 0, n2 = 0, n, comp;
+	int n1 = 0, n2 = 0, n, comp, run = 0;
 	if(cp1 = sfgetr(in1,'\n',0))
 		n1 = sfvalue(in1);
 	if(cp2 = sfgetr(in2,'\n',0))
@@ -84,6 +143,8 @@ static int comm(Sfio_t *in1, Sfio_t *in2, Sfio_t *out,int mode)
 				if(sfwrite(out,cp1,n) < 0)
 					return -1;
 			}
+			if(++run>1 && same(in1,in2,out,mode) < 0)
+				return -1;
 			if(cp1 = sfgetr(in1,'\n',0))
 				n1 = sfvalue(in1);
 			if(cp2 = sfgetr(in2,'\n',0))
@@ -91,6 +152,7 @@ static int comm(Sfio_t *in1, Sfio_t *in2, Sfio_t *out,int mode)
 		}
 		else if(comp > 0)
 		{
+			run = 0;
 			if(mode&C_FILE2)
 			{
 				if(mode&C_FILE1)
@@ -103,6 +165,7 @@ static int comm(Sfio_t *in1, Sfio_t *in2, Sfio_t *out,int mode)
 		}
 		else
 		{
+			run = 0;
 			if((mode&C_FILE1) && sfwrite(out,cp1,n1) < 0)
 				return -1;
 			if(cp1 = sfgetr(in1,'\n',0))
@@ -0,0 +1,913 @@
+/***********************************************************************
+*                                                                      *
+*              This file is part of the ksh 93u+m package              *
+*             Copyright (c) 2026 Contributors to ksh 93u+m             *
+*                      and is licensed under the                       *
+*                 Eclipse Public License, Version 2.0                  *
+*                                                                      *
+*                A copy of the License is available at                 *
+*      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      *
+*         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         *
+*                                                                      *
+***********************************************************************/
+/*
+ * find
+ *
+ * file trees are walked with fts(3) without changing directory; children
+ * that are not directories are not stat()ed unless a primary needs more
+ * than the file type, which readdir(3) usually provides
+ */
+
+static const char usage[] =
+"[-?\n@(#)$Id: find (ksh 93u+m) 2026-10-18 $\n]"
+"[--catalog?" ERROR_CATALOG "]"
+"[+NAME?find - find files in directory hierarchies]"
+"[+DESCRIPTION?\bfind\b recursively descends the directory hierarchy of "
+	"each \apath\a operand, or \b.\b if there are none, and evaluates "
+	"\aexpression\a for each file found, in the order the directories "
+	"are read. Options must precede the \apath\a operands, which must "
+	"precede the \aexpression\a; the first argument that starts with "
+	"\b-\b or is \b(\b or \b!\b starts the expression.]"
+"[+?If \aexpression\a contains no \b-exec\b, \b-print\b or \b-print0\b "
+	"primary, \b-print\b is implied for the files for which it is "
+	"true.]"
+"[+?Numeric arguments \an\a of the primaries below may be preceded by "
+	"\b+\b for more than \an\a or \b-\b for less than \an\a.]"
+"[+PRIMARIES?These evaluate as True if:]{"
+	"[+-name \apattern\a?The last component of the pathname matches the "
+		"shell \apattern\a.]"
+	"[+-iname \apattern\a?Like \b-name\b, ignoring case.]"
+	"[+-path \apattern\a?The pathname matches the shell \apattern\a.]"
+	"[+-type \ac\a?The file is of type \ac\a: \bb\b block special, "
+		"\bc\b character special, \bd\b directory, \bf\b regular "
+		"file, \bl\b symbolic link, \bp\b FIFO or \bs\b socket.]"
+	"[+-mtime \an\a?The file was last modified \an\a days ago, "
+		"rounded down.]"
+	"[+-mmin \an\a?The file was last modified \an\a minutes ago, "
+		"rounded down.]"
+	"[+-newer \afile\a?The file was modified more recently than "
+		"\afile\a.]"
+	"[+-size \an\a[\bckMG\b]]?The file uses \an\a 512-byte blocks, "
+		"rounded up, or \an\a bytes, KiB, MiB or GiB with the "
+		"suffix \bc\b, \bk\b, \bM\b or \bG\b.]"
+	"[+-prune?Always. Directories are not descended into.]"
+	"[+-print?Always. The pathname and a newline are written to the "
+		"standard output.]"
+	"[+-print0?Always. The pathname and a null byte are written to the "
+		"standard output.]"
+	"[+-exec \acommand\a [\aarg\a ...]] \b;\b?The \acommand\a, with each "
+		"\aarg\a that is \b{}\b replaced by the pathname, exits with "
+		"status 0.]"
+	"[+-exec \acommand\a [\aarg\a ...]] \b{} +\b?Always. The pathnames are "
+		"collected and \acommand\a is run with as many of them as "
+		"fit in an argument list appended to the \aargs\a. The exit "
+		"status of \bfind\b is 1 if any invocation fails.]"
+	"[+-depth?Always. Directories are evaluated after their contents.]"
+	"[+-maxdepth \an\a?Always. Files more than \an\a levels below the "
+		"\apath\a operands are not visited.]"
+	"[+-mindepth \an\a?Always. Files less than \an\a levels below the "
+		"\apath\a operands are not evaluated.]"
+	"[+-xdev?Always. Directories on other file systems are not "
+		"descended into.]"
+"}"
+"[+?Within the shell, \acommand\a is run by the shell like any other "
+	"command, so shell functions and built-ins run without creating a "
+	"process.]"
+"[+OPERATORS?In order of decreasing precedence:]{"
+	"[+( \aexpr\a )?True if \aexpr\a is True.]"
+	"[+! \aexpr\a?True if \aexpr\a is False. \b-not\b is the same.]"
+	"[+\aexpr1\a [-a]] \aexpr2\a?True if both are True; \aexpr2\a is "
+		"not evaluated if \aexpr1\a is False. \b-and\b is the same.]"
+	"[+\aexpr1\a -o \aexpr2\a?True if either is True; \aexpr2\a is not "
+		"evaluated if \aexpr1\a is True. \b-or\b is the same.]"
+"}"
+"[A:array?Assign the pathnames that would be written to the standard output "
+	"by \b-print\b or \b-print0\b to the elements of the indexed array "
+	"\aname\a instead. This only works when \bfind\b is a shell "
+	"built-in.]:[name]"
+"[H:metaphysical?Follow symbolic links given as \apath\a operands; "
+	"otherwise don't follow symbolic links.]"
+"[L:logical|follow?Follow symbolic links.]"
+"[P:physical|nofollow?Don't follow symbolic links. This is the default.]"
+"\n"
+"\n[ path ... ] [ expression ]\n"
+"\n"
+"[+EXIT STATUS?]{"
+	"[+0?All files were visited successfully.]"
+	"[+>0?An error occurred.]"
+"}"
+"[+SEE ALSO?\bfind\b(1), \bset\b(1), \bfts\b(3)]"
+;
+
+#include <cmd.h>
+#include <ctype.h>
+#include <ls.h>
+#include <fts.h>
+#include <proc.h>
+#include <regex.h>
+#include <tmx.h>
+
+#define F_AND		1
+#define F_OR		2
+#define F_NOT		3
+#define F_TRUE		4
+#define F_NAME		5
+#define F_PATH		6
+#define F_TYPE		7
+#define F_MTIME		8
+#define F_MMIN		9
+#define F_NEWER		10
+#define F_SIZE		11
+#define F_PRUNE		12
+#define F_PRINT		13
+#define F_EXEC		14
+
+#define M_REGEX		0		/* regnexec() */
+#define M_LITERAL	1		/* the whole name */
+#define M_SUFFIX	2		/* *literal */
+
+typedef struct List_s
+{
+	char		**argv;		/* fixed arguments then pathnames */
+	size_t		base;		/* number of fixed arguments */
+	size_t		argc;		/* number of arguments */
+	size_t		size;		/* allocated arguments */
+	size_t		bytes;		/* pathname bytes */
+} List_t;
+
+typedef struct Node_s
+{
+	struct Node_s	*next;		/* all nodes, for cleanup */
+	struct Node_s	*left;		/* operands */
+	struct Node_s	*right;
+	int		op;		/* F_* */
+	int		cmp;		/* -1 less, 0 equal, 1 more than num */
+	int		match;		/* M_* */
+	int		icase;		/* -iname */
+	Sfoff_t		num;		/* numeric argument */
+	char		*str;		/* string argument */
+	size_t		len;		/* strlen(str) */
+	regex_t		re;		/* compiled pattern */
+	int		compiled;	/* re needs regfree() */
+	char		**argv;		/* -exec command */
+	char		**args;		/* -exec ... ; arguments */
+	int		argc;
+	List_t		*list;		/* -exec ... {} + batch */
+} Node_t;
+
+typedef struct Find_s
+{
+	Shbltin_t	*context;	/* builtin context */
+	FTS		*fts;		/* tree walk */
+	Node_t		*nodes;		/* all nodes */
+	Node_t		*expr;		/* expression */
+	char		**argv;		/* next expression argument */
+	List_t		*array;		/* -A pathnames */
+	int		action;		/* the expression has an action */
+	int		depth;		/* -depth */
+	ssize_t		mindepth;	/* -mindepth */
+	ssize_t		maxdepth;	/* -maxdepth */
+	int		flags;		/* fts_open() flags */
+	int		status;		/* exit status */
+	size_t		argmax;		/* -exec + argument bytes */
+	time_t		now;		/* time at start */
+	struct stat	*stp;		/* stat of the current file, if known */
+	struct stat	st;		/* stat buffer */
+} Find_t;
+
+/*
+ * return a new expression node
+ */
+
+static Node_t *node(Find_t *fp, int op, Node_t *left, Node_t *right)
+{
+	Node_t	*np;
+
+	if (!(np = stkalloc(stkstd, sizeof(Node_t))))
+	{
+		error(ERROR_SYSTEM|ERROR_PANIC, "out of memory");
+		UNREACHABLE();
+	}
+	memset(np, 0, sizeof(Node_t));
+	np->op = op;
+	np->left = left;
+	np->right = right;
+	np->next = fp->nodes;
+	fp->nodes = np;
+	return np;
+}
+
+/*
+ * return a new pathname list with base fixed arguments from argv
+ */
+
+static List_t *list(char **argv, size_t base)
+{
+	List_t	*lp;
+
+	if (!(lp = newof(0, List_t, 1, 0)) || !(lp->argv = newof(0, char*, lp->size = base + 256, 0)))
+	{
+		error(ERROR_SYSTEM|ERROR_PANIC, "out of memory");
+		UNREACHABLE();
+	}
+	memcpy(lp->argv, argv, base * sizeof(char*));
+	lp->argc = lp->base = base;
+	return lp;
+}
+
+/*
+ * append a copy of path to lp
+ */
+
+static void append(List_t *lp, const char *path, size_t n)
+{
+	if (lp->argc + 1 >= lp->size)
+	{
+		lp->size *= 2;
+		if (!(lp->argv = newof(lp->argv, char*, lp->size, 0)))
+		{
+			error(ERROR_SYSTEM|ERROR_PANIC, "out of memory");
+			UNREACHABLE();
+		}
+	}
+	if (!(lp->argv[lp->argc++] = strdup(path)))
+	{
+		error(ERROR_SYSTEM|ERROR_PANIC, "out of memory");
+		UNREACHABLE();
+	}
+	lp->bytes += n + 1 + sizeof(char*);
+}
+
+/*
+ * free the pathnames in lp
+ */
+
+static void clear(List_t *lp)
+{
+	while (lp->argc > lp->base)
+		free(lp->argv[--lp->argc]);
+	lp->bytes = 0;
+}
+
+/*
+ * run a command, in the shell if there is one, and return its exit status
+ */
+
+static int run(Find_t *fp, int argc, char **argv)
+{
+	const char	*id = error_info.id;
+	int		r;
+
+	sfsync(sfstdout);
+	argv[argc] = 0;
+	if (fp->context)
+		r = sh_run(fp->context, argc, argv);
+	else
+		r = procrun(argv[0], argv, 0);
+	error_info.id = (char*)id;
+	return r;
+}
+
+/*
+ * run a -exec ... {} + command with the collected pathnames
+ */
+
+static void flush(Find_t *fp, List_t *lp)
+{
+	if (lp->argc > lp->base)
+	{
+		if (run(fp, lp->argc, lp->argv))
+			fp->status = 1;
+		clear(lp);
+	}
+}
+
+/*
+ * release everything
+ */
+
+static void done(Find_t *fp)
+{
+	Node_t	*np;
+
+	if (fp->fts)
+	{
+		fts_close(fp->fts);
+		fp->fts = 0;
+	}
+	for (np = fp->nodes; np; np = np->next)
+	{
+		if (np->compiled)
+		{
+			regfree(&np->re);
+			np->compiled = 0;
+		}
+		if (np->list)
+		{
+			clear(np->list);
+			free(np->list->argv);
+			free(np->list);
+			np->list = 0;
+		}
+	}
+	if (fp->array)
+	{
+		clear(fp->array);
+		free(fp->array->argv);
+		free(fp->array);
+		fp->array = 0;
+	}
+}
+
+/*
+ * return the stat of the current file, NULL on error
+ */
+
+static struct stat *getstat(Find_t *fp, FTSENT *ent)
+{
+	if (!fp->stp)
+	{
+		if (lstat(ent->fts_accpath, &fp->st))
+		{
+			error(ERROR_system(0), "%s: cannot stat", ent->fts_path);
+			return 0;
+		}
+		fp->stp = &fp->st;
+	}
+	return fp->stp;
+}
+
+/*
+ * compare n with the numeric argument of np
+ */
+
+static int compare(Node_t *np, Sfoff_t n)
+{
+	if (np->cmp < 0)
+		return n < np->num;
+	if (np->cmp > 0)
+		return n > np->num;
+	return n == np->num;
+}
+
+/*
+ * evaluate the expression np for the current file
+ */
+
+static int eval(Find_t *fp, Node_t *np, FTSENT *ent)
+{
+	struct stat	*st;
+	char		*s;
+	Sfoff_t		n;
+	int		i;
+
+	switch (np->op)
+	{
+	case F_AND:
+		return eval(fp, np->left, ent) && eval(fp, np->right, ent);
+	case F_OR:
+		return eval(fp, np->left, ent) || eval(fp, np->right, ent);
+	case F_NOT:
+		return !eval(fp, np->left, ent);
+	case F_TRUE:
+		return 1;
+	case F_NAME:
+	case F_PATH:
+		if (np->op == F_NAME)
+		{
+			s = ent->fts_name;
+			n = ent->fts_namelen;
+		}
+		else
+		{
+			s = ent->fts_path;
+			n = ent->fts_pathlen;
+		}
+		switch (np->match)
+		{
+		case M_LITERAL:
+			return n == np->len && !memcmp(s, np->str, n);
+		case M_SUFFIX:
+			return n >= np->len && !memcmp(s + n - np->len, np->str, np->len);
+		}
+		return !regnexec(&np->re, s, n, 0, NULL, 0);
+	case F_TYPE:
+		if (!fp->stp && ent->fts_statp->st_mode)
+			st = ent->fts_statp;
+		else if (!(st = getstat(fp, ent)))
+			return 0;
+		return (st->st_mode & S_IFMT) == np->num;
+	case F_MTIME:
+	case F_MMIN:
+		if (!(st = getstat(fp, ent)))
+			return 0;
+		n = fp->now - st->st_mtime;
+		i = np->op == F_MTIME ? 24 * 60 * 60 : 60;
+		n = n >= 0 ? n / i : -((-n + i - 1) / i);
+		return compare(np, n);
+	case F_NEWER:
+		if (!(st = getstat(fp, ent)))
+			return 0;
+		return tmxgetmtime(st) > (Time_t)np->num;
+	case F_SIZE:
+		if (!(st = getstat(fp, ent)))
+			return 0;
+		return compare(np, (st->st_size + np->len - 1) / np->len);
+	case F_PRUNE:
+		if (ent->fts_info == FTS_D)
+			fts_set(NULL, ent, FTS_SKIP);
+		return 1;
+	case F_PRINT:
+		if (fp->array)
+			append(fp->array, ent->fts_path, ent->fts_pathlen);
+		else
+			sfputr(sfstdout, ent->fts_path, np->num);
+		return 1;
+	case F_EXEC:
+		if (np->list)
+		{
+			if (np->list->argc > np->list->base && np->list->bytes + ent->fts_pathlen + 1 + sizeof(char*) > fp->argmax)
+				flush(fp, np->list);
+			append(np->list, ent->fts_path, ent->fts_pathlen);
+			return 1;
+		}
+		for (i = 0; i < np->argc; i++)
+			np->args[i] = streq(np->argv[i], "{}") ? ent->fts_path : np->argv[i];
+		return run(fp, np->argc, np->args) == 0;
+	}
+	return 0;
+}
+
+/*
+ * parse a numeric argument with optional sign into np
+ */
+
+static char *number(Node_t *np, char *s)
+{
+	char	*e;
+
+	if (*s == '+')
+	{
+		np->cmp = 1;
+		s++;
+	}
+	else if (*s == '-')
+	{
+		np->cmp = -1;
+		s++;
+	}
+	if (!isdigit(*(unsigned char*)s))
+		return 0;
+	np->num = strtoll(s, &e, 10);
+	return e;
+}
+
+static Node_t	*expr_or(Find_t*);
+
+/*
+ * parse a primary
+ */
+
+static Node_t *primary(Find_t *fp)
+{
+	Node_t		*np;
+	char		*s;
+	char		*t;
+	char		*a;
+	char		**v;
+	struct stat	st;
+
+	if (!(s = *fp->argv))
+	{
+		error(2, "expression expected");
+		return 0;
+	}
+	fp->argv++;
+	if (streq(s, "("))
+	{
+		if (!(np = expr_or(fp)))
+			return 0;
+		if (!*fp->argv || !streq(*fp->argv, ")"))
+		{
+			error(2, "missing )");
+			return 0;
+		}
+		fp->argv++;
+		return np;
+	}
+	if (streq(s, "!") || streq(s, "-not"))
+	{
+		if (!(np = primary(fp)))
+			return 0;
+		return node(fp, F_NOT, np, 0);
+	}
+	if (streq(s, "-prune"))
+		return node(fp, F_PRUNE, 0, 0);
+	if (streq(s, "-print") || streq(s, "-print0"))
+	{
+		fp->action = 1;
+		np = node(fp, F_PRINT, 0, 0);
+		np->num = s[6] ? 0 : '\n';
+		return np;
+	}
+	if (streq(s, "-depth"))
+	{
+		fp->depth = 1;
+		return node(fp, F_TRUE, 0, 0);
+	}
+	if (streq(s, "-xdev"))
+	{
+		fp->flags |= FTS_XDEV;
+		return node(fp, F_TRUE, 0, 0);
+	}
+	if (!strmatch(s, "-@(name|iname|path|type|mtime|mmin|newer|size|maxdepth|mindepth|exec)"))
+	{
+		error(2, "%s: unknown primary", s);
+		return 0;
+	}
+	if (!(a = *fp->argv++))
+	{
+		error(2, "%s: argument expected", s);
+		return 0;
+	}
+	if (streq(s, "-name") || streq(s, "-iname") || streq(s, "-path"))
+	{
+		np = node(fp, s[1] == 'p' ? F_PATH : F_NAME, 0, 0);
+		np->icase = s[1] == 'i';
+		np->str = a;
+		np->len = strlen(a);
+		/* literal and *literal patterns are matched without regex */
+		t = a + (*a == '*');
+		if (!np->icase && !t[strcspn(t, "*?[]\\()|&!@+~{}^$")])
+		{
+			np->match = t > a ? M_SUFFIX : M_LITERAL;
+			np->len -= t - a;
+			np->str = t;
+		}
+		else if (regcomp(&np->re, a, REG_SHELL|REG_AUGMENTED|REG_LEFT|REG_RIGHT|REG_NOSUB|(np->icase ? REG_ICASE : 0)))
+		{
+			error(2, "%s: invalid pattern", a);
+			return 0;
+		}
+		else
+			np->compiled = 1;
+		return np;
+	}
+	if (streq(s, "-type"))
+	{
+		np = node(fp, F_TYPE, 0, 0);
+		switch (a[1] ? 0 : a[0])
+		{
+		case 'b':
+			np->num = S_IFBLK;
+			break;
+		case 'c':
+			np->num = S_IFCHR;
+			break;
+		case 'd':
+			np->num = S_IFDIR;
+			break;
+		case 'f':
+			np->num = S_IFREG;
+			break;
+		case 'l':
+			np->num = S_IFLNK;
+			break;
+		case 'p':
+			np->num = S_IFIFO;
+			break;
+#ifdef S_IFSOCK
+		case 's':
+			np->num = S_IFSOCK;
+			break;
+#endif
+		default:
+			error(2, "%s: invalid file type", a);
+			return 0;
+		}
+		return np;
+	}
+	if (streq(s, "-mtime") || streq(s, "-mmin"))
+	{
+		np = node(fp, s[2] == 't' ? F_MTIME : F_MMIN, 0, 0);
+		if (!(t = number(np, a)) || *t)
+			goto bad;
+		return np;
+	}
+	if (streq(s, "-size"))
+	{
+		np = node(fp, F_SIZE, 0, 0);
+		if (!(t = number(np, a)))
+			goto bad;
+		switch (*t)
+		{
+		case 0:
+		case 'b':
+			np->len = 512;
+			break;
+		case 'c':
+			np->len = 1;
+			break;
+		case 'k':
+			np->len = 1024;
+			break;
+		case 'M':
+			np->len = 1024 * 1024;
+			break;
+		case 'G':
+			np->len = 1024 * 1024 * 1024;
+			break;
+		default:
+			goto bad;
+		}
+		if (*t && *(t + 1))
+			goto bad;
+		return np;
+	}
+	if (streq(s, "-maxdepth") || streq(s, "-mindepth"))
+	{
+		np = node(fp, F_TRUE, 0, 0);
+		if (!(t = number(np, a)) || *t || np->cmp)
+			goto bad;
+		if (s[2] == 'a')
+			fp->maxdepth = np->num;
+		else
+			fp->mindepth = np->num;
+		return np;
+	}
+	if (streq(s, "-newer"))
+	{
+		if (stat(a, &st))
+		{
+			error(ERROR_system(2), "%s: cannot stat", a);
+			return 0;
+		}
+		np = node(fp, F_NEWER, 0, 0);
+		np->num = (Sfoff_t)tmxgetmtime(&st);
+		return np;
+	}
+	if (streq(s, "-exec"))
+	{
+		fp->action = 1;
+		np = node(fp, F_EXEC, 0, 0);
+		if (streq(a, ";"))
+			goto bad;
+		for (v = fp->argv - 1; *fp->argv && !streq(*fp->argv, ";"); fp->argv++)
+			if (streq(*fp->argv, "+") && streq(*(fp->argv - 1), "{}"))
+			{
+				np->list = list(v, fp->argv - v - 1);
+				break;
+			}
+		if (!*fp->argv)
+		{
+			error(2, "%s: missing ; or {} +", s);
+			return 0;
+		}
+		np->argv = v;
+		np->argc = fp->argv++ - v;
+		if (!np->list && !(np->args = stkalloc(stkstd, (np->argc + 1) * sizeof(char*))))
+		{
+			error(ERROR_SYSTEM|ERROR_PANIC, "out of memory");
+			UNREACHABLE();
+		}
+		return np;
+	}
+ bad:
+	error(2, "%s %s: invalid argument", s, a);
+	return 0;
+}
+
+/*
+ * parse a sequence of primaries with optional -a
+ */
+
+static Node_t *expr_and(Find_t *fp)
+{
+	Node_t	*np;
+	Node_t	*rp;
+	char	*s;
+
+	if (!(np = primary(fp)))
+		return 0;
+	while ((s = *fp->argv) && !streq(s, "-o") && !streq(s, "-or") && !streq(s, ")"))
+	{
+		if (streq(s, "-a") || streq(s, "-and"))
+			fp->argv++;
+		if (!(rp = primary(fp)))
+			return 0;
+		np = node(fp, F_AND, np, rp);
+	}
+	return np;
+}
+
+/*
+ * parse an expression
+ */
+
+static Node_t *expr_or(Find_t *fp)
+{
+	Node_t	*np;
+	Node_t	*rp;
+
+	if (!(np = expr_and(fp)))
+		return 0;
+	while (*fp->argv && (streq(*fp->argv, "-o") || streq(*fp->argv, "-or")))
+	{
+		fp->argv++;
+		if (!(rp = expr_and(fp)))
+			return 0;
+		np = node(fp, F_OR, np, rp);
+	}
+	return np;
+}
+
+int
+b_find(int argc, char** argv, Shbltin_t* context)
+{
+	Find_t		*fp;
+	Node_t		*np;
+	FTSENT		*ent;
+	char		*array = 0;
+	char		*cp;
+	char		*s;
+	char		**paths;
+	char		*dot[4];
+	int		n;
+
+	if (argc <= 0)
+	{
+		if (context && (fp = (Find_t*)sh_context(context)->data))
+		{
+			sh_context(context)->data = 0;
+			done(fp);
+		}
+		return 0;
+	}
+	cmdinit(argc, argv, context, ERROR_CATALOG, ERROR_CALLBACK);
+	/*
+	 * only leading options are passed to optget(),
+	 * which would take primaries like -name for option clusters
+	 */
+	for (n = 1; (cp = argv[n]) && *cp == '-' && cp[1]; n++)
+	{
+		if (cp[1] == '-' || cp[1] == '?')
+		{
+			if (!cp[2])
+			{
+				n++;
+				break;
+			}
+			continue;
+		}
+		for (s = cp + 1; *s == 'H' || *s == 'L' || *s == 'P'; s++);
+		if (*s == 'A')
+		{
+			if (!*(s + 1) && argv[n + 1])
+				n++;
+		}
+		else if (*s)
+			break;
+	}
+	cp = argv[n];
+	argv[n] = 0;
+	if (!(fp = stkalloc(stkstd, sizeof(Find_t))))
+	{
+		error(ERROR_SYSTEM|ERROR_PANIC, "out of memory");
+		UNREACHABLE();
+	}
+	memset(fp, 0, sizeof(Find_t));
+	fp->context = context;
+	fp->flags = FTS_PHYSICAL|FTS_NOCHDIR|FTS_NOSTAT|FTS_DTYPE|FTS_SEEDOTDIR;
+	fp->maxdepth = -1;
+	for (;;)
+	{
+		switch (optget(argv, usage))
+		{
+		case 'A':
+			array = opt_info.arg;
+			continue;
+		case 'H':
+			fp->flags |= FTS_META|FTS_PHYSICAL;
+			continue;
+		case 'L':
+			fp->flags &= ~(FTS_META|FTS_PHYSICAL);
+			continue;
+		case 'P':
+			fp->flags &= ~FTS_META;
+			fp->flags |= FTS_PHYSICAL;
+			continue;
+		case ':':
+			error(2, "%s", opt_info.arg);
+			break;
+		case '?':
+			argv[n] = cp;
+			error(ERROR_usage(2), "%s", opt_info.arg);
+			UNREACHABLE();
+		}
+		break;
+	}
+	argv[n] = cp;
+	argv += opt_info.index;
+	if (error_info.errors)
+	{
+		error(ERROR_usage(2), "%s", optusage(NULL));
+		UNREACHABLE();
+	}
+	if (array && !context)
+	{
+		error(ERROR_exit(1), "-A requires the shell");
+		UNREACHABLE();
+	}
+	paths = argv;
+	while ((cp = *argv) && !(*cp == '-' && cp[1]) && !streq(cp, "(") && !streq(cp, "!"))
+		argv++;
+	if (context)
+		sh_context(context)->data = (void*)fp;
+	if (*(fp->argv = argv))
+	{
+		if ((fp->expr = expr_or(fp)) && *fp->argv)
+			error(2, "%s: unexpected argument", *fp->argv);
+		if (error_info.errors)
+		{
+			if (context)
+				sh_context(context)->data = 0;
+			done(fp);
+			error(ERROR_usage(2), "%s", optusage(NULL));
+			UNREACHABLE();
+		}
+	}
+	if (!fp->action)
+	{
+		/* -print is implied */
+		np = node(fp, F_PRINT, 0, 0);
+		np->num = '\n';
+		fp->expr = fp->expr ? node(fp, F_AND, fp->expr, np) : np;
+	}
+	if (array)
+	{
+		dot[0] = "set";
+		dot[1] = "-A";
+		dot[2] = array;
+		dot[3] = "--";
+		fp->array = list(dot, 4);
+	}
+	if (!fp->depth)
+		fp->flags |= FTS_NOPOSTORDER;
+	fp->argmax = strtol(astconf("ARG_MAX", NULL, NULL), NULL, 0) / 2;
+	if (fp->argmax < 4096)
+		fp->argmax = 4096;
+	fp->now = time(NULL);
+	cp = *argv;
+	*argv = 0;
+	if (paths == argv)
+	{
+		dot[0] = ".";
+		dot[1] = 0;
+		paths = dot;
+	}
+	fp->fts = fts_open(paths, fp->flags, NULL);
+	*argv = cp;
+	if (!fp->fts)
+		error(ERROR_system(0), "%s: not found", *paths);
+	else
+		while (!sh_checksig(context) && (ent = fts_read(fp->fts)))
+		{
+			switch (ent->fts_info)
+			{
+			case FTS_NS:
+				error(ERROR_system(0), "%s: not found", ent->fts_path);
+				continue;
+			case FTS_DC:
+				error(ERROR_warn(0), "%s: directory causes cycle", ent->fts_path);
+				continue;
+			case FTS_DNR:
+				error(ERROR_system(0), "%s: cannot read directory", ent->fts_path);
+				break;
+			case FTS_DNX:
+				error(ERROR_system(0), "%s: cannot search directory", ent->fts_path);
+				break;
+			case FTS_D:
+				if (fp->maxdepth >= 0 && ent->fts_level >= fp->maxdepth)
+					fts_set(NULL, ent, FTS_SKIP);
+				else if (fp->depth)
+					continue;
+				break;
+			}
+			if (ent->fts_level < fp->mindepth || fp->maxdepth >= 0 && ent->fts_level > fp->maxdepth)
+				continue;
+			fp->stp = ent->fts_info == FTS_NSOK ? 0 : ent->fts_statp;
+			eval(fp, fp->expr, ent);
+		}
+	for (np = fp->nodes; np; np = np->next)
+		if (np->list)
+			flush(fp, np->list);
+	if (fp->array)
+	{
+		if (run(fp, fp->array->argc, fp->array->argv))
+			fp->status = 1;
+	}
+	if (context)
+		sh_context(context)->data = 0;
+	done(fp);
+	return error_info.errors != 0 || fp->status;
+}
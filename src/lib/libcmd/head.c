@@ -24,7 +24,7 @@
  */
 
 static const char usage[] =
-"[-n?\n@(#)$Id: head (AT&T Research) 2013-09-19 $\n]"
+"[-n?\n@(#)$Id: head (ksh 93u+m) 2026-10-18 $\n]"
 "[--catalog?" ERROR_CATALOG "]"
 "[+NAME?head - output beginning portion of one or more files ]"
 "[+DESCRIPTION?\bhead\b copies one or more input files to standard "
@@ -66,6 +66,44 @@ static const char usage[] =
 ;
 
 #include <cmd.h>
+#include <ls.h>
+#include <range.h>
+
+#define CHUNK	(64*1024)
+
+/*
+ * return the offset just past the n'th delim at or after offset pos
+ * in the regular file fd of size end, or end if there are fewer;
+ * whole chunks are counted before any single delim is looked for
+ */
+
+static Sfoff_t
+lineend(int fd, Sfoff_t pos, Sfoff_t end, Sfoff_t n, int delim)
+{
+	char*		s;
+	ssize_t		r;
+	Sfoff_t		c;
+	char		buf[CHUNK];
+
+	while (pos < end)
+	{
+		if ((r = pread(fd, buf, end - pos < CHUNK ? (size_t)(end - pos) : CHUNK, pos)) <= 0)
+			return -1;
+		if ((c = range_count(buf, r, delim)) < n)
+		{
+			n -= c;
+			pos += r;
+			continue;
+		}
+		for (s = buf;; s++)
+		{
+			s = (char*)memchr(s, delim, buf + r - s);
+			if (!--n)
+				return pos + (s - buf) + 1;
+		}
+	}
+	return end;
+}
 
 int
 b_head(int argc, char** argv, Shbltin_t* context)
@@ -78,6 +116,9 @@ b_head(int argc, char** argv, Shbltin_t* context)
 	off_t		skip = 0;
 	int		delim = '\n';
 	off_t		moved;
+	Sfoff_t		pos;
+	Sfoff_t		end;
+	struct stat	st;
 	int		header = 1;
 	char*		format = (char*)header_fmt+1;
 
@@ -141,6 +182,22 @@ b_head(int argc, char** argv, Shbltin_t* context)
 		if (argc > header)
 			sfprintf(sfstdout, format, cp);
 		format = (char*)header_fmt;
+		if ((pos = sfseek(fp, (Sfoff_t)0, SEEK_CUR)) >= 0 && !fstat(sffileno(fp), &st) && S_ISREG(st.st_mode))
+		{
+			/* find the range in a regular file without reading it through sfio */
+			if (skip > 0)
+				pos = delim < 0 ? pos + skip : lineend(sffileno(fp), pos, st.st_size, skip, delim);
+			end = pos < 0 ? -1 : delim < 0 ? pos + keep : lineend(sffileno(fp), pos, st.st_size, keep, delim);
+			if (end > st.st_size)
+				end = st.st_size;
+			if (pos < 0 || end < 0)
+				error(ERROR_system(0), "%s: read error", cp);
+			else if (pos >= end)
+				sfseek(fp, end, SEEK_SET);
+			else if (range_copy(fp, pos, end, sfstdout) < 0 && !ERROR_PIPE(errno) && errno != EINTR)
+				error(ERROR_system(0), "%s: read error", cp);
+			goto next;
+		}
 		if (skip > 0)
 		{
 			if ((moved = sfmove(fp, NULL, skip, delim)) < 0 && !ERROR_PIPE(errno) && errno != EINTR)
@@ -0,0 +1,27 @@
+/***********************************************************************
+*                                                                      *
+*              This file is part of the ksh 93u+m package              *
+*             Copyright (c) 2026 Contributors to ksh 93u+m             *
+*                      and is licensed under the                       *
+*                 Eclipse Public License, Version 2.0                  *
+*                                                                      *
+*                A copy of the License is available at                 *
+*      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      *
+*         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         *
+*                                                                      *
+***********************************************************************/
+
+/*
+ * common support for byte and line ranges of seekable files
+ */
+
+#ifndef _RANGE_H
+#define _RANGE_H
+
+#define range_copy	_cmd_rangecopy
+#define range_count	_cmd_rangecount
+
+extern Sfoff_t		range_copy(Sfio_t*, Sfoff_t, Sfoff_t, Sfio_t*);
+extern Sfoff_t		range_count(const void*, size_t, int);
+
+#endif
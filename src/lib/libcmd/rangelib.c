@@ -0,0 +1,104 @@
+/***********************************************************************
+*                                                                      *
+*              This file is part of the ksh 93u+m package              *
+*             Copyright (c) 2026 Contributors to ksh 93u+m             *
+*                      and is licensed under the                       *
+*                 Eclipse Public License, Version 2.0                  *
+*                                                                      *
+*                A copy of the License is available at                 *
+*      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      *
+*         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         *
+*                                                                      *
+***********************************************************************/
+/*
+ * common support for cmp, head and tail
+ */
+
+#include	<cmd.h>
+#include	<ls.h>
+#include	<range.h>
+
+#include	"FEATURE/splice"
+
+#if _lib_sendfile && _sys_sendfile
+#include	<sys/sendfile.h>
+#else
+#undef	_lib_sendfile
+#endif
+
+#define CHUNK		(1024*1024*1024)	/* sendfile() chunk size */
+
+/*
+ * return the number of bytes equal to delim in the n bytes at buf
+ * eight bytes at a time: a byte of x is 0 where buf has delim,
+ * and the high bit of each such byte is set in m
+ */
+Sfoff_t range_count(const void *buf, size_t n, int delim)
+{
+	const unsigned char *s = (const unsigned char*)buf, *e = s + n;
+	uint64_t x, m, d = 0x0101010101010101ULL * (unsigned char)delim;
+	Sfoff_t count = 0;
+	for(; e-s >= 8; s += 8)
+	{
+		memcpy(&x,s,8);
+		x ^= d;
+		m = ~(((x&0x7f7f7f7f7f7f7f7fULL) + 0x7f7f7f7f7f7f7f7fULL) | x) & 0x8080808080808080ULL;
+		count += ((m>>7) * 0x0101010101010101ULL) >> 56;
+	}
+	while(s < e)
+		count += *s++ == delim;
+	return count;
+}
+
+/*
+ * copy bytes <start> through <end>-1 of the seekable file <in> to <out>,
+ * or up to the end of the file if <end> is negative, and leave <in>
+ * positioned after the last byte copied
+ * sendfile() copies the range without passing it through the sfio
+ * buffers when <out> writes straight to a file descriptor
+ * the number of bytes copied is returned, -1 on error
+ */
+Sfoff_t range_copy(Sfio_t *in, Sfoff_t start, Sfoff_t end, Sfio_t *out)
+{
+	Sfoff_t n;
+#if _lib_sendfile
+	Sfdisc_t *dp;
+	struct stat st;
+	off_t off = start;
+	ssize_t r = 0;
+	size_t m;
+	if(!(sfset(out,0,0)&SFIO_STRING) && sffileno(out)>=0 && sffileno(in)>=0 && !sfsync(out))
+	{
+		for(dp=sfdisc(out,(Sfdisc_t*)out); dp && !dp->writef; dp=dp->disc);
+		if(!dp)
+		{
+			while(end<0 || off<end)
+			{
+				m = (end<0 || end-off>CHUNK) ? CHUNK : (size_t)(end-off);
+				if((r = sendfile(sffileno(out),sffileno(in),&off,m)) <= 0)
+					break;
+			}
+			if(r>=0 || off>start || errno!=EINVAL && errno!=ENOSYS)
+			{
+				/* the file offset of <out> moved behind the back of sfio */
+				if(!fstat(sffileno(out),&st) && S_ISREG(st.st_mode))
+					sfseek(out,(Sfoff_t)0,SEEK_CUR|SFIO_PUBLIC);
+				n = off;
+				if(r < 0)
+				{
+					r = errno;
+					sfseek(in,n,SEEK_SET);
+					errno = r;
+					return -1;
+				}
+				if(sfseek(in,n,SEEK_SET) != n)
+					return -1;
+				return n - start;
+			}
+		}
+	}
+#endif
+	if(sfseek(in,start,SEEK_SET)!=start || (n = sfmove(in,out,end<0?SFIO_UNBOUND:end-start,-1)) < 0)
+		return -1;
+	return n;
+}
@@ -0,0 +1,1125 @@
+/***********************************************************************
+*                                                                      *
+*              This file is part of the ksh 93u+m package              *
+*             Copyright (c) 2026 Contributors to ksh 93u+m             *
+*                      and is licensed under the                       *
+*                 Eclipse Public License, Version 2.0                  *
+*                                                                      *
+*                A copy of the License is available at                 *
+*      https://www.eclipse.org/org/documents/epl-2.0/EPL-2.0.html      *
+*         (with md5 checksum 84283fa8859daf213bdda5a9f8d1be1d)         *
+*                                                                      *
+***********************************************************************/
+/*
+ * sort
+ *
+ * each record's sort key is encoded once, when the record is read, into
+ * a byte string that compares correctly with memcmp(); the first eight
+ * key bytes are cached as an integer prefix so most comparisons never
+ * touch the key itself; input exceeding the memory budget is sorted in
+ * runs that are spilled to temporary files and merged
+ */
+
+static const char usage[] =
+"[-?\n@(#)$Id: sort (ksh 93u+m) 2026-10-18 $\n]"
+"[--catalog?" ERROR_CATALOG "]"
+"[+NAME?sort - sort, merge or sequence check text files]"
+"[+DESCRIPTION?\bsort\b sorts the lines of all the named files together "
+	"and writes the result on the standard output. If no \afile\a is "
+	"given, or if the \afile\a is \b-\b, \bsort\b reads from standard "
+	"input.]"
+"[+?Comparisons are based on one or more sort keys extracted from each "
+	"line of input. By default there is one sort key, the entire input "
+	"line. Lines are ordered according to the collating sequence of the "
+	"current locale. Lines that compare equal are ordered with all bytes "
+	"significant, unless \b-s\b or \b-u\b is specified.]"
+"[+?Input that does not fit in the memory budget set by \b-S\b is sorted "
+	"in parts that are written to temporary files in the directory named "
+	"by \b-T\b or the \bTMPDIR\b environment variable and then merged.]"
+"[b:ignore-leading-blanks?Ignore leading blanks when determining the "
+	"starting and ending positions of a restricted sort key.]"
+"[c:check?Check that the single input file is sorted. No output is "
+	"produced; a diagnostic is written for the first out-of-order "
+	"line and the exit status is 1.]"
+"[C:check-quiet|silent?Like \b-c\b, but no diagnostic is written.]"
+"[d:dictionary-order?Only blanks and alphanumeric characters are "
+	"significant in comparisons.]"
+"[f:ignore-case|fold-case?Fold lowercase letters to uppercase for "
+	"comparisons.]"
+"[i:ignore-nonprinting?Ignore non-printable characters in comparisons.]"
+"[k:key?Define a restricted sort key. \akeydef\a has the form "
+	"\apos1\a[\b,\b\apos2\a]]; the key begins at \apos1\a and ends at "
+	"\apos2\a, or at the end of the line if \apos2\a is omitted. A "
+	"position has the form \afield\a[\b.\b\achar\a]][\amodifiers\a]], "
+	"where fields and characters are numbered from 1. A \achar\a of 0 "
+	"or an omitted \achar\a in \apos2\a means the last character of the "
+	"field. The \amodifiers\a are any of \bbdfinr\b with the meaning of "
+	"the corresponding options, applied to this key only; a key without "
+	"modifiers inherits those given as options. Keys are compared in "
+	"the order given.]:[keydef]"
+"[m:merge?Merge the input files, which are assumed to be sorted.]"
+"[n:numeric-sort?Compare an initial numeric string consisting of optional "
+	"blanks, an optional minus sign, and zero or more digits with an "
+	"optional decimal point, by arithmetic value. An empty numeric string "
+	"is treated as zero.]"
+"[o:output?Write output to \afile\a instead of the standard output. "
+	"\afile\a may be the same as one of the input files.]:[file]"
+"[r:reverse?Reverse the sense of comparisons.]"
+"[s:stable?Keep lines with equal keys in input order.]"
+"[S:buffer-size?Use at most \asize\a bytes of memory for sorting before "
+	"spilling to temporary files. \asize\a may end in one of the unit "
+	"suffixes accepted by \bhead\b(1).]#[size:=64Mi]"
+"[t:field-separator?Use \achar\a as the field separator. Each occurrence "
+	"of \achar\a is significant. By default a field is a maximal sequence "
+	"of non-blank characters along with any preceding blanks.]:[char]"
+"[T:temporary-directory?Create temporary files in \adir\a.]:[dir]"
+"[u:unique?Output only the first of each set of lines with equal keys. "
+	"With \b-c\b, check for strict ordering.]"
+"[z:zero-terminated?Lines are terminated by a null byte instead of a "
+	"newline.]"
+"\n"
+"\n[ file ... ]\n"
+"\n"
+"[+EXIT STATUS?]{"
+	"[+0?All input files were processed successfully, or with \b-c\b or "
+		"\b-C\b, the input file is sorted.]"
+	"[+1?With \b-c\b or \b-C\b, the input file is not sorted.]"
+	"[+>1?An error occurred.]"
+"}"
+"[+SEE ALSO?\bcomm\b(1), \bjoin\b(1), \buniq\b(1)]"
+;
+
+#include <cmd.h>
+#include <ctype.h>
+
+#define SORT_BUDGET	(64*1024*1024)	/* default memory budget */
+#define SORT_BLOCK	(256*1024)	/* record storage block size */
+#define SORT_MERGE	16		/* maximum runs merged at once */
+#define SORT_INSERT	16		/* insertion sort below this size */
+
+#define K_BLANKS	0x01		/* b: skip blanks before pos1 */
+#define K_DICT		0x02		/* d: dictionary order */
+#define K_FOLD		0x04		/* f: fold to uppercase */
+#define K_PRINT		0x08		/* i: printable characters only */
+#define K_NUMBER	0x10		/* n: numeric */
+#define K_REVERSE	0x20		/* r: reverse */
+#define K_EBLANKS	0x40		/* b: skip blanks before pos2 */
+#define K_ORDER		(K_DICT|K_FOLD|K_PRINT|K_NUMBER|K_REVERSE)
+
+#define NOFIELD		((size_t)-1)
+
+typedef struct Key_s
+{
+	struct Key_s	*next;
+	int		flags;		/* K_* modifiers */
+	size_t		sfield;		/* pos1 field, from 0 */
+	size_t		schar;		/* pos1 char, from 0 */
+	size_t		efield;		/* pos2 field, from 0, or NOFIELD */
+	size_t		echar;		/* pos2 char, 0 for end of field */
+} Key_t;
+
+typedef struct Rec_s
+{
+	uint64_t	prefix;		/* first key bytes, big endian */
+	char		*key;		/* encoded key */
+	size_t		klen;		/* encoded key length */
+	char		*data;		/* record without terminator */
+	size_t		size;		/* record size */
+} Rec_t;
+
+typedef struct Block_s
+{
+	struct Block_s	*next;
+	char		*end;		/* end of data */
+	char		data[1];
+} Block_t;
+
+typedef struct Buf_s
+{
+	char		*data;
+	size_t		size;
+} Buf_t;
+
+typedef struct Sort_s
+{
+	Shbltin_t	*context;	/* builtin context */
+	Key_t		*keys;		/* -k keys */
+	Key_t		*last;		/* last -k key */
+	int		flags;		/* global modifiers */
+	int		tab;		/* -t separator or -1 */
+	int		eol;		/* record terminator */
+	int		stable;		/* -s */
+	int		unique;		/* -u */
+	int		raw;		/* the record is its own key */
+	size_t		budget;		/* -S memory budget */
+	char		*tmpdir;	/* -T directory */
+	Rec_t		*rec;		/* records in memory */
+	Rec_t		*tmp;		/* merge sort work space */
+	size_t		nrec;		/* number of records */
+	size_t		mrec;		/* allocated records */
+	Block_t		*block;		/* record storage */
+	char		*next;		/* next free storage byte */
+	size_t		used;		/* record bytes charged to the budget */
+	Sfio_t		**run;		/* spilled runs */
+	int		*level;		/* run merge levels */
+	size_t		nrun;		/* number of runs */
+	size_t		mrun;		/* allocated runs */
+	Buf_t		key;		/* key encoding buffer */
+	Buf_t		xfrm;		/* collation buffer */
+	Buf_t		prev;		/* previous key for -u and -c */
+} Sort_t;
+
+/*
+ * make room for n more bytes at b->data+off
+ */
+
+static char *bufgrow(Buf_t *b, size_t off, size_t n)
+{
+	size_t	z;
+
+	if (off + n > b->size)
+	{
+		z = roundof(off + n, 1024);
+		if (!(b->data = newof(b->data, char, z, 0)))
+		{
+			error(ERROR_SYSTEM|ERROR_PANIC, "out of memory");
+			UNREACHABLE();
+		}
+		b->size = z;
+	}
+	return b->data + off;
+}
+
+/*
+ * return the position of field f char c in [s,e)
+ * for pos2 (end!=0) the position is just past the char, c==0 is end of field
+ */
+
+static char *position(Sort_t *sp, char *s, char *e, size_t f, size_t c, int blanks, int end)
+{
+	if (sp->tab >= 0)
+	{
+		while (f-- > 0)
+			if (!(s = memchr(s, sp->tab, e - s)))
+				return e;
+			else
+				s++;
+	}
+	else
+		while (f-- > 0)
+		{
+			while (s < e && isblank(*(unsigned char*)s))
+				s++;
+			while (s < e && !isblank(*(unsigned char*)s))
+				s++;
+		}
+	if (blanks)
+		while (s < e && isblank(*(unsigned char*)s))
+			s++;
+	if (end && !c)
+	{
+		if (sp->tab >= 0)
+			return (s = memchr(s, sp->tab, e - s)) ? s : e;
+		while (s < e && isblank(*(unsigned char*)s))
+			s++;
+		while (s < e && !isblank(*(unsigned char*)s))
+			s++;
+		return s;
+	}
+	return c < (size_t)(e - s) ? s + c : e;
+}
+
+/*
+ * append the escaped text key [s,e) at offset off of the key buffer
+ * 0x00 and 0x01 are escaped so that 0x00 terminates the key
+ * and shorter keys order before longer keys they are a prefix of
+ */
+
+static size_t textkey(Sort_t *sp, size_t off, const unsigned char *s, const unsigned char *e, int flags)
+{
+	unsigned char	*t;
+	int		c;
+	size_t		n;
+	size_t		z;
+
+	if (flags & (K_DICT|K_FOLD|K_PRINT))
+	{
+		t = (unsigned char*)bufgrow(&sp->xfrm, 0, e - s + 1);
+		for (; s < e; s++)
+		{
+			c = *s;
+			if ((flags & K_DICT) && !isblank(c) && !isalnum(c))
+				continue;
+			if ((flags & K_PRINT) && !isprint(c))
+				continue;
+			*t++ = (flags & K_FOLD) ? toupper(c) : c;
+		}
+		s = (unsigned char*)sp->xfrm.data;
+		e = t;
+	}
+	if (mbcoll())
+	{
+		/* the transformed string has no null bytes and compares like the original with strcoll() */
+		n = e - s;
+		if (s != (unsigned char*)sp->xfrm.data)
+			memcpy(bufgrow(&sp->xfrm, 0, n + 1), s, n);
+		sp->xfrm.data[n] = 0;
+		z = mbxfrm(NULL, sp->xfrm.data, 0);
+		t = (unsigned char*)bufgrow(&sp->xfrm, n + 1, z + 1);
+		mbxfrm(t, sp->xfrm.data, z + 1);
+		s = t;
+		e = t + z;
+	}
+	t = (unsigned char*)bufgrow(&sp->key, off, 2 * (e - s) + 1);
+	while (s < e)
+	{
+		if ((c = *s++) <= 1)
+		{
+			*t++ = 1;
+			c++;
+		}
+		*t++ = c;
+	}
+	*t++ = 0;
+	return (char*)t - sp->key.data;
+}
+
+/*
+ * append the numeric key [s,e) at offset off of the key buffer
+ * the sign and the number of integral digits lead so that
+ * the remaining digits compare as text
+ */
+
+static size_t numkey(Sort_t *sp, size_t off, const char *s, const char *e)
+{
+	unsigned char	*t;
+	const char	*b;
+	const char	*d;
+	size_t		n;
+	int		neg = 0;
+	int		x;
+
+	while (s < e && isblank(*(unsigned char*)s))
+		s++;
+	if (s < e && *s == '-')
+	{
+		neg = 1;
+		s++;
+	}
+	while (s < e && *s == '0')
+		s++;
+	for (b = s; s < e && isdigit(*(unsigned char*)s); s++);
+	n = s - b;
+	d = s;
+	if (s < e && *s == '.')
+		for (d = ++s; d < e && isdigit(*(unsigned char*)d); d++);
+	/* ignore trailing fraction zeros */
+	while (d > s && d[-1] == '0')
+		d--;
+	t = (unsigned char*)bufgrow(&sp->key, off, (d - b) + 6);
+	if (!n && d <= s)
+	{
+		*t++ = 0x80;
+		return (char*)t - sp->key.data;
+	}
+	x = neg ? 0xff : 0;
+	*t++ = neg ? 0x7f : 0x81;
+	*t++ = ((n >> 24) & 0xff) ^ x;
+	*t++ = ((n >> 16) & 0xff) ^ x;
+	*t++ = ((n >> 8) & 0xff) ^ x;
+	*t++ = (n & 0xff) ^ x;
+	for (; b < d; b++)
+		if (*b != '.')
+			*t++ = *(unsigned char*)b ^ x;
+	*t++ = x;
+	return (char*)t - sp->key.data;
+}
+
+/*
+ * encode the key of record [s,s+n) in sp->key and return its length
+ */
+
+static size_t encode(Sort_t *sp, char *s, size_t n)
+{
+	Key_t		*kp;
+	Key_t		whole;
+	char		*e = s + n;
+	char		*b;
+	char		*x;
+	size_t		off = 0;
+	size_t		beg;
+	unsigned char	*t;
+
+	if (!(kp = sp->keys))
+	{
+		memset(&whole, 0, sizeof(whole));
+		whole.flags = sp->flags;
+		whole.efield = NOFIELD;
+		kp = &whole;
+	}
+	for (; kp; kp = kp->next)
+	{
+		b = position(sp, s, e, kp->sfield, kp->schar, kp->flags & K_BLANKS, 0);
+		x = kp->efield == NOFIELD ? e : position(sp, s, e, kp->efield, kp->echar, kp->flags & K_EBLANKS, 1);
+		if (x < b)
+			x = b;
+		beg = off;
+		if (kp->flags & K_NUMBER)
+			off = numkey(sp, off, b, x);
+		else
+			off = textkey(sp, off, (unsigned char*)b, (unsigned char*)x, kp->flags);
+		if (kp->flags & K_REVERSE)
+			for (t = (unsigned char*)sp->key.data + beg; t < (unsigned char*)sp->key.data + off; t++)
+				*t = ~*t;
+	}
+	return off;
+}
+
+static uint64_t prefix(const char *s, size_t n)
+{
+	const unsigned char	*u = (const unsigned char*)s;
+	uint64_t		p = 0;
+	int			i;
+
+	for (i = 0; i < 8; i++)
+		p = (p << 8) | (i < n ? u[i] : 0);
+	return p;
+}
+
+/*
+ * compare the keys only
+ */
+
+static int keycmp(Sort_t *sp, const Rec_t *a, const Rec_t *b)
+{
+	size_t	n;
+	int	r;
+
+	if (a->prefix != b->prefix)
+		r = a->prefix < b->prefix ? -1 : 1;
+	else
+	{
+		n = a->klen < b->klen ? a->klen : b->klen;
+		if (n <= 8 || !(r = memcmp(a->key + 8, b->key + 8, n - 8)))
+			r = a->klen < b->klen ? -1 : a->klen > b->klen;
+	}
+	if (sp->raw && (sp->flags & K_REVERSE))
+		r = -r;
+	return r;
+}
+
+/*
+ * compare records, using all bytes as a last resort
+ */
+
+static int reccmp(Sort_t *sp, const Rec_t *a, const Rec_t *b)
+{
+	size_t	n;
+	int	r;
+
+	if ((r = keycmp(sp, a, b)) || sp->raw || sp->stable || sp->unique)
+		return r;
+	n = a->size < b->size ? a->size : b->size;
+	if (!(r = memcmp(a->data, b->data, n)))
+		r = a->size < b->size ? -1 : a->size > b->size;
+	return (sp->flags & K_REVERSE) ? -r : r;
+}
+
+/*
+ * stable bottom-up merge sort of sp->rec
+ */
+
+static void sortrec(Sort_t *sp)
+{
+	Rec_t	*src = sp->rec;
+	Rec_t	*dst = sp->tmp;
+	Rec_t	*t;
+	Rec_t	r;
+	size_t	n = sp->nrec;
+	size_t	w;
+	size_t	i, j, k, m, e;
+
+	for (i = 0; i < n; i += SORT_INSERT)
+	{
+		e = i + SORT_INSERT < n ? i + SORT_INSERT : n;
+		for (j = i + 1; j < e; j++)
+		{
+			r = src[j];
+			for (k = j; k > i && reccmp(sp, &src[k - 1], &r) > 0; k--)
+				src[k] = src[k - 1];
+			src[k] = r;
+		}
+	}
+	for (w = SORT_INSERT; w < n; w *= 2)
+	{
+		for (i = 0; i < n; i += 2 * w)
+		{
+			m = i + w < n ? i + w : n;
+			e = i + 2 * w < n ? i + 2 * w : n;
+			j = i;
+			k = m;
+			if (m < e && reccmp(sp, &src[m - 1], &src[m]) <= 0)
+			{
+				memcpy(dst + i, src + i, (e - i) * sizeof(Rec_t));
+				continue;
+			}
+			t = dst + i;
+			while (j < m && k < e)
+				*t++ = reccmp(sp, &src[k], &src[j]) < 0 ? src[k++] : src[j++];
+			while (j < m)
+				*t++ = src[j++];
+			while (k < e)
+				*t++ = src[k++];
+		}
+		t = src;
+		src = dst;
+		dst = t;
+	}
+	sp->rec = src;
+	sp->tmp = dst;
+}
+
+/*
+ * storage for records and keys, charged against the memory budget
+ * along with the record array; allocation overhead is not counted
+ */
+
+static char *store(Sort_t *sp, size_t n)
+{
+	Block_t	*bp;
+	size_t	z;
+	char	*s;
+
+	if (!sp->block || sp->block->end - sp->next < n)
+	{
+		z = n > SORT_BLOCK ? n : SORT_BLOCK;
+		if (!(bp = newof(0, Block_t, 1, z)))
+		{
+			error(ERROR_SYSTEM|ERROR_PANIC, "out of memory");
+			UNREACHABLE();
+		}
+		bp->end = bp->data + z;
+		bp->next = sp->block;
+		sp->block = bp;
+		sp->next = bp->data;
+	}
+	s = sp->next;
+	sp->next += n;
+	sp->used += n;
+	return s;
+}
+
+static void release(Sort_t *sp)
+{
+	Block_t	*bp;
+
+	while (bp = sp->block)
+	{
+		sp->block = bp->next;
+		free(bp);
+	}
+	sp->next = 0;
+	free(sp->rec);
+	free(sp->tmp);
+	sp->rec = sp->tmp = 0;
+	sp->nrec = sp->mrec = 0;
+	sp->used = 0;
+}
+
+/*
+ * set up record r for [s,s+n) with its key in sp->key
+ */
+
+static void setrec(Sort_t *sp, Rec_t *r, char *s, size_t n)
+{
+	r->data = s;
+	r->size = n;
+	if (sp->raw)
+	{
+		r->key = s;
+		r->klen = n;
+	}
+	else
+	{
+		r->klen = encode(sp, s, n);
+		r->key = sp->key.data;
+	}
+	r->prefix = prefix(r->key, r->klen);
+}
+
+/*
+ * add record [s,s+n) to the in-memory array
+ */
+
+static void addrec(Sort_t *sp, char *s, size_t n)
+{
+	Rec_t	*r;
+	size_t	m;
+
+	if (sp->nrec >= sp->mrec)
+	{
+		m = sp->mrec ? sp->mrec * 2 : 1024;
+		if (!(sp->rec = newof(sp->rec, Rec_t, m, 0)) || !(sp->tmp = newof(sp->tmp, Rec_t, m, 0)))
+		{
+			error(ERROR_SYSTEM|ERROR_PANIC, "out of memory");
+			UNREACHABLE();
+		}
+		sp->mrec = m;
+	}
+	r = &sp->rec[sp->nrec++];
+	sp->used += 2 * sizeof(Rec_t);
+	setrec(sp, r, s, n);
+	r->data = memcpy(store(sp, n + (sp->raw ? 0 : r->klen)), s, n);
+	if (sp->raw)
+		r->key = r->data;
+	else
+		r->key = memcpy(r->data + n, r->key, r->klen);
+}
+
+/*
+ * write record r unless it duplicates the previous one under -u
+ */
+
+static int put(Sort_t *sp, Sfio_t *op, Rec_t *r, int *first)
+{
+	Rec_t	p;
+
+	if (sp->unique)
+	{
+		if (!*first)
+		{
+			p.key = sp->prev.data;
+			p.klen = sp->prev.size;
+			p.prefix = prefix(p.key, p.klen);
+			if (!keycmp(sp, &p, r))
+				return 0;
+		}
+		memcpy(bufgrow(&sp->prev, 0, r->klen), r->key, r->klen);
+		sp->prev.size = r->klen;
+		*first = 0;
+	}
+	if (sfwrite(op, r->data, r->size) != r->size || sfputc(op, sp->eol) < 0)
+		return -1;
+	return 0;
+}
+
+static Sfio_t *tmpfile_open(Sort_t *sp)
+{
+	Sfio_t	*fp;
+	char	*path;
+	int	fd;
+
+	if (path = pathtemp(NULL, PATH_MAX, sp->tmpdir, "sort", &fd))
+	{
+		remove(path);
+		free(path);
+		if (!(fp = sfnew(NULL, NULL, SFIO_UNBOUND, fd, SFIO_READ|SFIO_WRITE)))
+			close(fd);
+	}
+	else
+		fp = 0;
+	if (!fp)
+		error(ERROR_SYSTEM|2, "cannot create temporary file");
+	return fp;
+}
+
+static int	collapse(Sort_t*, int);
+
+/*
+ * sort the records in memory and spill them to a new run
+ */
+
+static int spill(Sort_t *sp)
+{
+	Sfio_t	*fp;
+	size_t	i;
+	int	first = 1;
+
+	sortrec(sp);
+	if (sp->nrun >= sp->mrun)
+	{
+		sp->mrun = sp->mrun ? sp->mrun * 2 : SORT_MERGE;
+		if (!(sp->run = newof(sp->run, Sfio_t*, sp->mrun, 0)) || !(sp->level = newof(sp->level, int, sp->mrun, 0)))
+		{
+			error(ERROR_SYSTEM|ERROR_PANIC, "out of memory");
+			UNREACHABLE();
+		}
+	}
+	if (!(fp = tmpfile_open(sp)))
+		return -1;
+	sp->level[sp->nrun] = 0;
+	sp->run[sp->nrun++] = fp;
+	for (i = 0; i < sp->nrec; i++)
+		if (put(sp, fp, &sp->rec[i], &first))
+		{
+			error(ERROR_SYSTEM|2, "temporary file write error");
+			return -1;
+		}
+	if (sfsync(fp) || sfseek(fp, 0, SEEK_SET))
+	{
+		error(ERROR_SYSTEM|2, "temporary file write error");
+		return -1;
+	}
+	release(sp);
+	return collapse(sp, 0);
+}
+
+/*
+ * read the next record of a merge input into r
+ */
+
+static int next(Sort_t *sp, Sfio_t *fp, Rec_t *r, Buf_t *kb)
+{
+	char	*s;
+	size_t	n;
+
+	if (s = sfgetr(fp, sp->eol, 0))
+		n = sfvalue(fp) - 1;
+	else if (s = sfgetr(fp, sp->eol, SFIO_LASTR))
+		n = sfvalue(fp);
+	else
+		return 0;
+	setrec(sp, r, s, n);
+	if (!sp->raw)
+	{
+		memcpy(bufgrow(kb, 0, r->klen), r->key, r->klen);
+		r->key = kb->data;
+	}
+	return 1;
+}
+
+/*
+ * merge n sorted streams to op
+ */
+
+static int merge(Sort_t *sp, Sfio_t **in, size_t n, Sfio_t *op)
+{
+	Rec_t	*rec;
+	Buf_t	*kb;
+	char	*live;
+	size_t	i;
+	size_t	m;
+	int	first = 1;
+	int	r = 0;
+
+	if (!(rec = newof(0, Rec_t, n, 0)) || !(kb = newof(0, Buf_t, n, 0)) || !(live = newof(0, char, n, 0)))
+	{
+		error(ERROR_SYSTEM|ERROR_PANIC, "out of memory");
+		UNREACHABLE();
+	}
+	for (i = 0; i < n; i++)
+		live[i] = next(sp, in[i], &rec[i], &kb[i]);
+	for (;;)
+	{
+		m = n;
+		for (i = 0; i < n; i++)
+			if (live[i] && (m == n || reccmp(sp, &rec[i], &rec[m]) < 0))
+				m = i;
+		if (m == n)
+			break;
+		if (put(sp, op, &rec[m], &first))
+		{
+			error(ERROR_SYSTEM|2, "write error");
+			r = -1;
+			break;
+		}
+		live[m] = next(sp, in[m], &rec[m], &kb[m]);
+	}
+	for (i = 0; i < n; i++)
+		free(kb[i].data);
+	free(kb);
+	free(rec);
+	free(live);
+	return r;
+}
+
+/*
+ * merge the last SORT_MERGE runs into one while they have the same level,
+ * so each record is merged a logarithmic number of times, or with all set,
+ * until at most SORT_MERGE runs remain; only adjacent runs are merged to
+ * keep equal records in input order
+ */
+
+static int collapse(Sort_t *sp, int all)
+{
+	Sfio_t	*fp;
+	size_t	i;
+	size_t	k;
+
+	while (all ? sp->nrun > SORT_MERGE : sp->nrun >= SORT_MERGE && sp->level[sp->nrun - SORT_MERGE] == sp->level[sp->nrun - 1])
+	{
+		if (sh_checksig(sp->context) || !(fp = tmpfile_open(sp)))
+			return -1;
+		k = sp->nrun - SORT_MERGE;
+		if (merge(sp, sp->run + k, SORT_MERGE, fp) || sfsync(fp) || sfseek(fp, 0, SEEK_SET))
+		{
+			sfclose(fp);
+			return -1;
+		}
+		for (i = k; i < sp->nrun; i++)
+			sfclose(sp->run[i]);
+		sp->run[k] = fp;
+		sp->level[k] = sp->level[sp->nrun - 1] + 1;
+		sp->nrun = k + 1;
+	}
+	return 0;
+}
+
+/*
+ * read all records from fp, spilling when the budget is exceeded
+ */
+
+static int input(Sort_t *sp, Sfio_t *fp)
+{
+	char	*s;
+	size_t	n;
+
+	for (;;)
+	{
+		if (s = sfgetr(fp, sp->eol, 0))
+			n = sfvalue(fp) - 1;
+		else if (s = sfgetr(fp, sp->eol, SFIO_LASTR))
+			n = sfvalue(fp);
+		else
+			break;
+		addrec(sp, s, n);
+		if (sp->used >= sp->budget)
+		{
+			if (sh_checksig(sp->context) || spill(sp))
+				return -1;
+		}
+	}
+	return sferror(fp) ? -1 : 0;
+}
+
+/*
+ * check that fp is sorted
+ */
+
+static int check(Sort_t *sp, Sfio_t *fp, const char *name, int quiet)
+{
+	Rec_t	r[2];
+	Buf_t	kb[2];
+	Buf_t	db[2];
+	size_t	line = 1;
+	int	i = 0;
+	int	c;
+	int	status = 0;
+
+	memset(kb, 0, sizeof(kb));
+	memset(db, 0, sizeof(db));
+	if (next(sp, fp, &r[0], &kb[0]))
+	{
+		r[0].data = memcpy(bufgrow(&db[0], 0, r[0].size + 1), r[0].data, r[0].size);
+		if (sp->raw)
+			r[0].key = r[0].data;
+		while (next(sp, fp, &r[!i], &kb[!i]))
+		{
+			line++;
+			i = !i;
+			if ((c = reccmp(sp, &r[!i], &r[i])) > 0 || !c && sp->unique)
+			{
+				if (!quiet)
+					error(0, "%s:%I*u: disorder: %.*s", name, sizeof(line), line, (int)r[i].size, r[i].data);
+				status = 1;
+				break;
+			}
+			r[i].data = memcpy(bufgrow(&db[i], 0, r[i].size + 1), r[i].data, r[i].size);
+			if (sp->raw)
+				r[i].key = r[i].data;
+		}
+	}
+	for (i = 0; i < 2; i++)
+	{
+		free(kb[i].data);
+		free(db[i].data);
+	}
+	return status;
+}
+
+/*
+ * parse a -k position, return the first char after it or 0 on error
+ */
+
+static char *keypos(char *s, size_t *field, size_t *chr, int *flags, int end)
+{
+	char	*e;
+	long	n;
+
+	n = strtol(s, &e, 10);
+	if (e == s || n <= 0)
+		return 0;
+	*field = n - 1;
+	*chr = 0;
+	if (*(s = e) == '.')
+	{
+		n = strtol(++s, &e, 10);
+		if (e == s || n < 0 || !end && n == 0)
+			return 0;
+		*chr = end ? n : n - 1;
+		s = e;
+	}
+	for (;; s++)
+		switch (*s)
+		{
+		case 'b':
+			*flags |= end ? K_EBLANKS : K_BLANKS;
+			break;
+		case 'd':
+			*flags |= K_DICT;
+			break;
+		case 'f':
+			*flags |= K_FOLD;
+			break;
+		case 'i':
+			*flags |= K_PRINT;
+			break;
+		case 'n':
+			*flags |= K_NUMBER;
+			break;
+		case 'r':
+			*flags |= K_REVERSE;
+			break;
+		default:
+			return s;
+		}
+}
+
+static int addkey(Sort_t *sp, char *s)
+{
+	Key_t	*kp;
+
+	if (!(kp = newof(0, Key_t, 1, 0)))
+	{
+		error(ERROR_SYSTEM|ERROR_PANIC, "out of memory");
+		UNREACHABLE();
+	}
+	kp->efield = NOFIELD;
+	if (!(s = keypos(s, &kp->sfield, &kp->schar, &kp->flags, 0)) ||
+	    *s == ',' && (!(s = keypos(s + 1, &kp->efield, &kp->echar, &kp->flags, 1))) ||
+	    *s)
+	{
+		free(kp);
+		return -1;
+	}
+	if (sp->last)
+		sp->last->next = kp;
+	else
+		sp->keys = kp;
+	sp->last = kp;
+	return 0;
+}
+
+int
+b_sort(int argc, char** argv, Shbltin_t* context)
+{
+	Sort_t		sort;
+	Sort_t		*sp = &sort;
+	Key_t		*kp;
+	Sfio_t		*fp;
+	Sfio_t		*op;
+	Sfio_t		**in;
+	char		*cp;
+	char		*output = 0;
+	size_t		i;
+	int		chk = 0;
+	int		mrg = 0;
+	int		n;
+
+	cmdinit(argc, argv, context, ERROR_CATALOG, 0);
+	memset(sp, 0, sizeof(*sp));
+	sp->context = context;
+	sp->tab = -1;
+	sp->eol = '\n';
+	sp->budget = SORT_BUDGET;
+	for (;;)
+	{
+		switch (optget(argv, usage))
+		{
+		case 'b':
+			sp->flags |= K_BLANKS|K_EBLANKS;
+			continue;
+		case 'c':
+			chk = 'c';
+			continue;
+		case 'C':
+			chk = 'C';
+			continue;
+		case 'd':
+			sp->flags |= K_DICT;
+			continue;
+		case 'f':
+			sp->flags |= K_FOLD;
+			continue;
+		case 'i':
+			sp->flags |= K_PRINT;
+			continue;
+		case 'k':
+			if (addkey(sp, opt_info.arg))
+				error(2, "%s: invalid key specification", opt_info.arg);
+			continue;
+		case 'm':
+			mrg = 1;
+			continue;
+		case 'n':
+			sp->flags |= K_NUMBER;
+			continue;
+		case 'o':
+			output = opt_info.arg;
+			continue;
+		case 'r':
+			sp->flags |= K_REVERSE;
+			continue;
+		case 's':
+			sp->stable = 1;
+			continue;
+		case 'S':
+			if (opt_info.number <= 0)
+				error(2, "%s: invalid buffer size", opt_info.arg);
+			else
+				sp->budget = opt_info.number;
+			continue;
+		case 't':
+			if (!opt_info.arg[0] || opt_info.arg[1])
+				error(2, "%s: field separator must be a single byte", opt_info.arg);
+			sp->tab = *(unsigned char*)opt_info.arg;
+			continue;
+		case 'T':
+			sp->tmpdir = opt_info.arg;
+			continue;
+		case 'u':
+			sp->unique = 1;
+			continue;
+		case 'z':
+			sp->eol = 0;
+			continue;
+		case ':':
+			error(2, "%s", opt_info.arg);
+			break;
+		case '?':
+			error(ERROR_usage(2), "%s", opt_info.arg);
+			UNREACHABLE();
+		}
+		break;
+	}
+	argv += opt_info.index;
+	argc -= opt_info.index;
+	if (chk && argc > 1)
+		error(2, "only one file may be checked");
+	if (error_info.errors)
+	{
+		while (kp = sp->keys)
+		{
+			sp->keys = kp->next;
+			free(kp);
+		}
+		error(ERROR_usage(2), "%s", optusage(NULL));
+		UNREACHABLE();
+	}
+	/* keys without ordering modifiers inherit the global ones */
+	for (kp = sp->keys; kp; kp = kp->next)
+		if (!(kp->flags & (K_ORDER|K_BLANKS|K_EBLANKS)))
+			kp->flags = sp->flags;
+	sp->raw = !sp->keys && !(sp->flags & ~K_REVERSE) && !mbcoll();
+	if (!argc)
+	{
+		static char*	dash[] = { "-", 0 };
+
+		argv = dash;
+		argc = 1;
+	}
+	if (!(in = newof(0, Sfio_t*, argc, 0)))
+	{
+		error(ERROR_SYSTEM|ERROR_PANIC, "out of memory");
+		UNREACHABLE();
+	}
+	for (n = 0; n < argc; n++)
+	{
+		cp = argv[n];
+		if (streq(cp, "-"))
+			in[n] = sfstdin;
+		else if (!(in[n] = sfopen(NULL, cp, "r")))
+		{
+			error(ERROR_system(0), "%s: cannot open", cp);
+			error_info.errors = 2;
+			break;
+		}
+	}
+	if (error_info.errors)
+		;
+	else if (chk)
+		error_info.errors = check(sp, in[0], argv[0], chk == 'C');
+	else if (mrg)
+	{
+		/* merge to a temporary file in case the output is also an input */
+		if (fp = output ? tmpfile_open(sp) : sfstdout)
+		{
+			if (merge(sp, in, argc, fp))
+				error_info.errors = 2;
+			else if (output)
+			{
+				if (sfsync(fp) || sfseek(fp, 0, SEEK_SET) || !(op = sfopen(NULL, output, "w")))
+					error(ERROR_SYSTEM|2, "%s: cannot create", output);
+				else
+				{
+					if (sfmove(fp, op, SFIO_UNBOUND, -1) < 0 || sfsync(op))
+						error(ERROR_SYSTEM|2, "%s: write error", output);
+					sfclose(op);
+				}
+			}
+			if (fp != sfstdout)
+				sfclose(fp);
+		}
+	}
+	else
+	{
+		for (n = 0; n < argc; n++)
+			if (input(sp, in[n]))
+			{
+				if (!sh_checksig(context))
+					error(ERROR_SYSTEM|2, "%s: read error", argv[n]);
+				break;
+			}
+		if (!error_info.errors && !sh_checksig(context))
+		{
+			/* all input has been read, so the output may replace an input */
+			op = sfstdout;
+			if (output && !(op = sfopen(NULL, output, "w")))
+				error(ERROR_SYSTEM|2, "%s: cannot create", output);
+			else if (!sp->nrun)
+			{
+				int	first = 1;
+
+				sortrec(sp);
+				for (i = 0; i < sp->nrec; i++)
+					if (put(sp, op, &sp->rec[i], &first))
+					{
+						error(ERROR_SYSTEM|2, "write error");
+						break;
+					}
+			}
+			else if ((!sp->nrec || !spill(sp)) && !collapse(sp, 1))
+				merge(sp, sp->run, sp->nrun, op);
+			if (op && op != sfstdout)
+				sfclose(op);
+		}
+	}
+	for (n = 0; n < argc; n++)
+		if (in[n] && in[n] != sfstdin)
+			sfclose(in[n]);
+	free(in);
+	for (i = 0; i < sp->nrun; i++)
+		sfclose(sp->run[i]);
+	free(sp->run);
+	free(sp->level);
+	release(sp);
+	free(sp->key.data);
+	free(sp->xfrm.data);
+	free(sp->prev.data);
+	while (kp = sp->keys)
+	{
+		sp->keys = kp->next;
+		free(kp);
+	}
+	return error_info.errors > 1 || error_info.errors && !chk ? 2 : error_info.errors;
+}
@@ -26,7 +26,7 @@
  */
 
 static const char usage[] =
-"+[-?\n@(#)$Id: tail (AT&T Research) 2013-09-19 $\n]"
+"+[-?\n@(#)$Id: tail (ksh 93u+m) 2026-10-18 $\n]"
 "[--catalog?" ERROR_CATALOG "]"
 "[+NAME?tail - output trailing portion of one or more files ]"
 "[+DESCRIPTION?\btail\b copies one or more input files to standard output "
@@ -105,6 +105,7 @@ static const char usage[] =
 #include <ls.h>
 #include <tv.h>
 #include <rev.h>
+#include <range.h>
 #include <time.h>
 
 #define COUNT		(1<<0)
@@ -124,6 +125,8 @@ static const char usage[] =
 
 #define DEFAULT		10
 
+#define CHUNK		(64*1024)
+
 #ifdef S_ISSOCK
 #define FIFO(m)		(S_ISFIFO(m)||S_ISSOCK(m))
 #else
@@ -148,21 +151,26 @@ struct Tail_s
 static const char	header_fmt[] = "\n==> %s <==\n";
 
 /*
- * if file is seekable, position file to tail location and return offset
+ * if file is seekable, return the offset of the tail location
  * otherwise, return -1
+ * the file is read backwards from the end in chunks with pread(),
+ * bypassing the sfio buffer; delimiters are counted a whole chunk
+ * at a time until the chunk holding the tail location is found
  */
 
 static Sfoff_t
 tailpos(Sfio_t* fp, Sfoff_t number, int delim)
 {
-	size_t		n;
+	ssize_t		n;
 	Sfoff_t	offset;
 	Sfoff_t	first;
 	Sfoff_t	last;
+	Sfoff_t	c;
 	char*		s;
 	char*		t;
 	unsigned char		incomplete;
 	struct stat		st;
+	char		buf[CHUNK];
 
 	last = sfsize(fp);
 	if ((first = sfseek(fp, 0, SEEK_CUR)) < 0)
@@ -176,29 +184,26 @@ tailpos(Sfio_t* fp, Sfoff_t number, int delim)
 	incomplete = 1;
 	for (;;)
 	{
-		if ((offset = last - SFIO_BUFSIZE) < first)
+		if ((offset = last - CHUNK) < first)
 			offset = first;
-		sfseek(fp, offset, SEEK_SET);
 		n = last - offset;
-		if (!(s = sfreserve(fp, n, SFIO_LOCKR)))
+		if (n > 0 && pread(sffileno(fp), buf, n, offset) != n)
 			return -1;
+		s = buf;
 		t = s + n;
 		if (incomplete)
 		{
 			if (t > s && *(t - 1) != delim && number-- <= 0)
-			{
-				sfread(fp, s, 0);
 				return offset + (t - s);
-			}
 			incomplete = 0;
 		}
-		while (t > s)
-			if (*--t == delim && number-- <= 0)
-			{
-				sfread(fp, s, 0);
-				return offset + (t - s) + 1;
-			}
-		sfread(fp, s, 0);
+		if ((c = range_count(s, n, delim)) > number)
+		{
+			/* the tail starts after delimiter c-number of this chunk */
+			for (c -= number; (s = (char*)memchr(s, delim, t - s) + 1) && --c;);
+			return offset + (s - buf);
+		}
+		number -= c;
 		if (offset == first)
 			break;
 		last = offset;
@@ -789,10 +794,7 @@ b_tail(int argc, char** argv, Shbltin_t* context)
 					if (flags & REVERSE)
 						rev_line(ip, sfstdout, offset);
 					else
-					{
-						sfseek(ip, offset, SEEK_SET);
-						sfmove(ip, sfstdout, SFIO_UNBOUND, -1);
-					}
+						range_copy(ip, offset, -1, sfstdout);
 				}
 				else
 				{
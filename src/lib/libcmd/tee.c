@@ -24,7 +24,7 @@
  */
 
 static const char usage[] =
-"[-?\n@(#)$Id: tee (AT&T Research) 2012-05-31 $\n]"
+"[-?\n@(#)$Id: tee (ksh 93u+m) 2026-10-18 $\n]"
 "[--catalog?" ERROR_CATALOG "]"
 "[+NAME?tee - duplicate standard input]"
 "[+DESCRIPTION?\btee\b copies standard input to standard output "
@@ -53,6 +53,10 @@ static const char usage[] =
 #include <ls.h>
 #include <sig.h>
 
+#include "FEATURE/splice"
+
+#define TEE_PIPESIZE	(1024*1024)
+
 typedef struct Tee_s
 {
 	Sfdisc_t	disc;
@@ -87,6 +91,168 @@ tee_write(Sfio_t* fp, const void* buf, size_t n, Sfdisc_t* handle)
 	return n;
 }
 
+#if _lib_splice && _lib_tee
+
+/*
+ * move n bytes from the private pipe src to fd with splice()
+ * once fd refuses that with EINVAL or ENOSYS, *slow is set and
+ * the data for fd is copied with read() and write() from then on
+ */
+
+static int
+tee_move(int src, int fd, ssize_t n, int flags, char* slow, char** buf, ssize_t size)
+{
+	ssize_t		m;
+	ssize_t		r;
+	ssize_t		w;
+
+	while (n > 0)
+	{
+		if (!*slow)
+		{
+			if ((r = splice(src, NULL, fd, NULL, n, flags)) > 0)
+			{
+				n -= r;
+				continue;
+			}
+			if (!r || errno != EINVAL && errno != ENOSYS)
+				return -1;
+			*slow = 1;
+		}
+		if (!*buf && !(*buf = newof(0, char, size, 0)))
+			return -1;
+		if ((r = read(src, *buf, n < size ? n : size)) <= 0)
+			return -1;
+		n -= r;
+		for (m = 0; m < r; m += w)
+			if ((w = write(fd, *buf + m, r - m)) <= 0)
+				return -1;
+	}
+	return 0;
+}
+
+/*
+ * copy the standard input to out and the files in hp
+ * without copying the data to user space where possible:
+ * splice() moves the input to a private pipe, tee() duplicates
+ * that for each output but the last, and splice() moves the copies
+ * to the outputs; an output that does not support splice() gets
+ * its copies with read() and write() instead
+ * 1 returned if the input cannot be spliced and nothing was copied
+ * 0 returned on success, -1 on error
+ */
+
+static int
+tee_splice(int out, int* hp)
+{
+	int*		xp;
+	char*		buf = 0;
+	char*		slow;
+	int		in = sffileno(sfstdin);
+	int		fd;
+	int		i;
+	int		last;
+	int		moved = 0;
+	int		src;
+	int		p[2];
+	int		q[2];
+	ssize_t		size;
+	ssize_t		n;
+	ssize_t		m;
+	ssize_t		t;
+	ssize_t		r;
+
+	if (sfstdin->_next < sfstdin->_endr || (sfset(sfstdout, 0, 0) & SFIO_STRING))
+		return 1;
+	for (i = 1, xp = hp; xp && *xp >= 0; xp++)
+		i++;
+	if (!(slow = newof(0, char, i, 0)))
+		return 1;
+	p[0] = p[1] = q[0] = q[1] = -1;
+	if (pipe(p) || hp && pipe(q))
+		goto nope;
+	/*
+	 * a tee() into the empty q duplicates all of p
+	 * as long as q has at least as many buffer slots as p
+	 */
+#ifdef F_SETPIPE_SZ
+	if ((size = fcntl(p[1], F_SETPIPE_SZ, TEE_PIPESIZE)) < 0 && (size = fcntl(p[1], F_GETPIPE_SZ)) < 0)
+		goto nope;
+	if (hp && fcntl(q[1], F_SETPIPE_SZ, size) < size)
+		goto nope;
+#else
+	size = PIPE_BUF;
+#endif
+	if (sfsync(sfstdout))
+		goto nope;
+	while ((n = splice(in, NULL, p[1], NULL, size, SPLICE_F_MOVE)) > 0)
+	{
+		moved = 1;
+		for (fd = out, xp = hp, i = 0; fd >= 0; fd = xp ? *xp++ : -1, i++)
+		{
+			if (last = !xp || *xp < 0)
+			{
+				src = p[0];
+				t = n;
+			}
+			else
+			{
+				src = q[0];
+				if ((t = tee(p[0], q[1], n, 0)) <= 0)
+					goto bad;
+			}
+			if (tee_move(src, fd, t, last ? SPLICE_F_MOVE : SPLICE_F_MOVE|SPLICE_F_MORE, &slow[i], &buf, size))
+				goto bad;
+			if (t < n)
+			{
+				/*
+				 * a short tee() cannot be resumed at an offset
+				 * so finish this block with read() and write()
+				 */
+				if (!buf && !(buf = newof(0, char, size, 0)))
+					goto bad;
+				for (m = 0; m < n; m += r)
+					if ((r = read(p[0], buf + m, n - m)) <= 0)
+						goto bad;
+				do
+				{
+					for (m = t; m < n; m += r)
+						if ((r = write(fd, buf + m, n - m)) <= 0)
+							goto bad;
+					t = 0;
+				} while ((fd = *xp++) >= 0);
+				break;
+			}
+		}
+	}
+	if (n < 0 && !moved && (errno == EINVAL || errno == ENOSYS))
+		goto nope;
+	if (n < 0)
+		goto bad;
+	r = 0;
+	goto done;
+ nope:
+	r = 1;
+	goto done;
+ bad:
+	r = -1;
+ done:
+	n = errno;
+	for (i = 0; i < 2; i++)
+	{
+		if (p[i] >= 0)
+			close(p[i]);
+		if (q[i] >= 0)
+			close(q[i]);
+	}
+	free(buf);
+	free(slow);
+	errno = n;
+	return r;
+}
+
+#endif
+
 static void
 tee_cleanup(Tee_t* tp)
 {
@@ -111,6 +277,7 @@ b_tee(int argc, char** argv, Shbltin_t* context)
 	int*		hp;
 	char*		cp;
 	int		line;
+	int		r;
 
 	if (argc <= 0)
 	{
@@ -198,7 +365,13 @@ b_tee(int argc, char** argv, Shbltin_t* context)
 			UNREACHABLE();
 		}
 	}
-	if ((sfmove(sfstdin, sfstdout, SFIO_UNBOUND, -1) < 0 || !sfeof(sfstdin)) && !ERROR_PIPE(errno) && errno != EINTR)
+	r = 1;
+#if _lib_splice && _lib_tee
+	r = tee_splice(sffileno(sfstdout), tp ? tp->fd : 0);
+#endif
+	if (r > 0)
+		r = sfmove(sfstdin, sfstdout, SFIO_UNBOUND, -1) < 0 || !sfeof(sfstdin) ? -1 : 0;
+	if (r < 0 && !ERROR_PIPE(errno) && errno != EINTR)
 		error(ERROR_system(0), "read error");
 	if (sfsync(sfstdout))
 		error(ERROR_system(0), "write error");
@@ -48,6 +48,12 @@ static const char usage[] =
     "before checking for uniqueness. A field is the minimal string matching "
     "the BRE \b[[:blank:]]]]*[^[:blank:]]]]*\b. -\anumber\a is equivalent to "
     "\b--skip-fields\b=\anumber\a.]"
+"[H:hash|unsorted?Compare each line with all previous lines instead of only "
+	"the adjacent one, so that the input need not be sorted. Lines are "
+	"written in the order of their first occurrence. With \b-c\b, \b-d\b "
+	"or \b-u\b, output is deferred until all input has been read and "
+	"every distinct line is kept in memory; otherwise only the distinct "
+	"comparison keys are kept.]"
 "[i:ignore-case?Ignore case in comparisons.]"
 "[s:skip-chars]#[chars?\achars\a is the number of characters to skip over "
 	"before checking for uniqueness.  If specified along with \b-f\b, "
@@ -69,6 +75,7 @@ static const char usage[] =
 ;
 
 #include <cmd.h>
+#include <ctype.h>
 
 #define C_FLAG	1
 #define D_FLAG	2
@@ -79,10 +86,56 @@ static const char usage[] =
 
 typedef int (*Compare_f)(const char*, const char*, size_t);
 
+/*
+ * locate the comparison key of the n byte record at bufp
+ * after skipping fields and chars, limited to width chars
+ * the key length is returned in *reclen
+ */
+
+static char *reckey(char *bufp, int n, int fields, int chars, int width, int mb, int *reclen)
+{
+	char	*cp = bufp, *ep = bufp + n, *mp;
+	int	f;
+	if (f = fields)
+		while (f-->0 && cp<ep) /* skip over fields */
+		{
+			while (cp<ep && *cp==' ' || *cp=='\t')
+				cp++;
+			while (cp<ep && *cp!=' ' && *cp!='\t')
+				cp++;
+		}
+	if (chars)
+	{
+		if (mb)
+			for (f = chars; f; f--)
+				mbchar(cp);
+		else
+			cp += chars;
+	}
+	if ((*reclen = n - (cp - bufp)) <= 0)
+	{
+		*reclen = 1;
+		cp = bufp + n - 1;
+	}
+	else if (width >= 0 && width < *reclen)
+	{
+		if (mb)
+		{
+			mp = cp;
+			for (f = 0; f < width && mp < ep; f++)
+				mbchar(mp);
+			*reclen = mp - cp;
+		}
+		else
+			*reclen = width;
+	}
+	return cp;
+}
+
 static int uniq(Sfio_t *fdin, Sfio_t *fdout, int fields, int chars, int width, int mode, int* all, Compare_f compare)
 {
 	int n, f, outsize=0, mb = mbwide();
-	char *cp=NULL, *ep, *mp, *bufp, *outp=NULL;
+	char *cp=NULL, *bufp, *outp=NULL;
 	char *orecp=NULL, *sbufp=0, *outbuff;
 	int reclen,oreclen= -1,count=0,cwidth=0,sep,next;
 	if(mode&C_FLAG)
@@ -100,47 +153,7 @@ static int uniq(Sfio_t *fdin, Sfio_t *fdout, int fields, int chars, int width, i
 		else
 			n = 0;
 		if (n)
-		{
-			cp = bufp;
-			ep = cp + n;
-			if (f = fields)
-				while (f-->0 && cp<ep) /* skip over fields */
-				{
-					while (cp<ep && *cp==' ' || *cp=='\t')
-						cp++;
-					while (cp<ep && *cp!=' ' && *cp!='\t')
-						cp++;
-				}
-			if (chars)
-			{
-				if (mb)
-					for (f = chars; f; f--)
-						mbchar(cp);
-				else
-					cp += chars;
-			}
-			if ((reclen = n - (cp - bufp)) <= 0)
-			{
-				reclen = 1;
-				cp = bufp + n - 1;
-			}
-			else if (width >= 0 && width < reclen)
-			{
-				if (mb)
-				{
-					reclen = 0;
-					mp = cp;
-					while (reclen < width && mp < ep)
-					{
-						reclen++;
-						mbchar(mp);
-					}
-					reclen = mp - cp;
-				}
-				else
-					reclen = width;
-			}
-		}
+			cp = reckey(bufp, n, fields, chars, width, mb, &reclen);
 		else
 			reclen = -2;
 		if(reclen==oreclen && (!reclen || !(*compare)(cp,orecp,reclen)))
@@ -239,6 +252,208 @@ static int uniq(Sfio_t *fdin, Sfio_t *fdout, int fields, int chars, int width, i
 	return 0;
 }
 
+/*
+ * hashed mode for unsorted input
+ * distinct keys are kept in an open addressing table of record indices
+ * so that one pass in input order suffices; whole records are only
+ * saved when -c, -d or -u require output to wait for the final counts
+ */
+
+#define H_BLOCK		(64*1024)
+#define H_SLOTS		1024
+
+typedef struct Hblock_s
+{
+	struct Hblock_s	*next;
+	char		data[1];
+} Hblock_t;
+
+typedef struct Hrec_s
+{
+	char		*data;		/* saved record or key */
+	size_t		size;		/* saved size */
+	size_t		koff;		/* key offset in data */
+	size_t		klen;		/* key length */
+	unsigned long	hash;		/* key hash */
+	unsigned long	count;		/* number of occurrences */
+} Hrec_t;
+
+typedef struct Hash_s
+{
+	Hrec_t		*rec;		/* distinct records in input order */
+	size_t		nrec;		/* number of records */
+	size_t		mrec;		/* allocated records */
+	size_t		*slot;		/* record index + 1, 0 if empty */
+	size_t		mask;		/* number of slots - 1 */
+	Hblock_t	*block;		/* saved data blocks */
+	char		*next;		/* next free byte in current block */
+	char		*last;		/* end of current block */
+	size_t		bytes;		/* total bytes allocated */
+} Hash_t;
+
+static unsigned long hkey(const char *s, size_t n, int icase)
+{
+	const unsigned char	*cp = (const unsigned char*)s;
+	const unsigned char	*ep = cp + n;
+	unsigned long		h = 0xcbf29ce484222325UL;
+
+	if (icase)
+		while (cp < ep)
+			h = (h ^ tolower(*cp++)) * 0x100000001b3UL;
+	else
+		while (cp < ep)
+			h = (h ^ *cp++) * 0x100000001b3UL;
+	return h;
+}
+
+static char *hsave(Hash_t *hp, const char *s, size_t n)
+{
+	Hblock_t	*bp;
+	size_t		z;
+	char		*cp;
+
+	if (hp->last - hp->next < n)
+	{
+		z = n > H_BLOCK ? n : H_BLOCK;
+		if (!(bp = newof(0, Hblock_t, 1, z)))
+			return NULL;
+		hp->bytes += sizeof(Hblock_t) + z;
+		bp->next = hp->block;
+		hp->block = bp;
+		hp->next = bp->data;
+		hp->last = bp->data + z;
+	}
+	cp = hp->next;
+	hp->next += n;
+	return memcpy(cp, s, n);
+}
+
+static int hgrow(Hash_t *hp)
+{
+	size_t	*slot;
+	size_t	mask;
+	size_t	i;
+	size_t	k;
+
+	mask = hp->mask ? (hp->mask << 1) | 1 : H_SLOTS - 1;
+	if (!(slot = newof(0, size_t, mask + 1, 0)))
+		return -1;
+	for (i = 0; i < hp->nrec; i++)
+	{
+		for (k = hp->rec[i].hash & mask; slot[k]; k = (k + 1) & mask);
+		slot[k] = i + 1;
+	}
+	if (hp->slot)
+	{
+		free(hp->slot);
+		hp->bytes -= (hp->mask + 1) * sizeof(size_t);
+	}
+	hp->bytes += (mask + 1) * sizeof(size_t);
+	hp->slot = slot;
+	hp->mask = mask;
+	return 0;
+}
+
+static int huniq(Sfio_t *fdin, Sfio_t *fdout, int fields, int chars, int width, int mode, Compare_f compare)
+{
+	Hash_t		hash;
+	Hrec_t		*rp;
+	char		*bufp, *cp;
+	size_t		i, k;
+	unsigned long	h;
+	int		n, reclen, r = 1;
+	int		mb = mbwide();
+	int		icase = compare != (Compare_f)memcmp;
+	int		save = mode & (C_FLAG|D_FLAG|U_FLAG);
+
+	memset(&hash, 0, sizeof(hash));
+	if (hgrow(&hash))
+		goto nospace;
+	for (;;)
+	{
+		if (bufp = sfgetr(fdin, '\n', 0))
+			n = sfvalue(fdin);
+		else if (bufp = sfgetr(fdin, '\n', SFIO_LASTR))
+		{
+			n = sfvalue(fdin);
+			bufp = memcpy(fmtbuf(n + 1), bufp, n);
+			bufp[n++] = '\n';
+		}
+		else
+			break;
+		cp = reckey(bufp, n, fields, chars, width, mb, &reclen);
+		h = hkey(cp, reclen, icase);
+		for (k = h & hash.mask; i = hash.slot[k]; k = (k + 1) & hash.mask)
+		{
+			rp = &hash.rec[i - 1];
+			if (rp->hash == h && rp->klen == reclen && !(*compare)(cp, rp->data + rp->koff, reclen))
+				break;
+		}
+		if (i)
+		{
+			hash.rec[i - 1].count++;
+			continue;
+		}
+		if (hash.nrec >= hash.mrec)
+		{
+			i = hash.mrec ? hash.mrec * 2 : H_SLOTS;
+			if (!(rp = oldof(hash.rec, Hrec_t, i, 0)))
+				goto nospace;
+			hash.bytes += (i - hash.mrec) * sizeof(Hrec_t);
+			hash.rec = rp;
+			hash.mrec = i;
+		}
+		rp = &hash.rec[hash.nrec];
+		if (save)
+		{
+			rp->data = hsave(&hash, bufp, n);
+			rp->size = n;
+			rp->koff = cp - bufp;
+		}
+		else
+		{
+			rp->data = hsave(&hash, cp, reclen);
+			rp->size = reclen;
+			rp->koff = 0;
+		}
+		if (!rp->data)
+			goto nospace;
+		rp->klen = reclen;
+		rp->hash = h;
+		rp->count = 0;
+		hash.slot[k] = ++hash.nrec;
+		if (!save && sfwrite(fdout, bufp, n) != n)
+			goto done;
+		if (hash.nrec * 2 > hash.mask && hgrow(&hash))
+			goto nospace;
+	}
+	if (save)
+		for (i = 0; i < hash.nrec; i++)
+		{
+			rp = &hash.rec[i];
+			if (((mode&D_FLAG) && rp->count == 0) || ((mode&U_FLAG) && rp->count))
+				continue;
+			if ((mode&C_FLAG) && sfprintf(fdout, "%4lu ", rp->count + 1) < 0)
+				goto done;
+			if (sfwrite(fdout, rp->data, rp->size) != rp->size)
+				goto done;
+		}
+	r = 0;
+	goto done;
+ nospace:
+	error(ERROR_SYSTEM|2, "out of memory [%I*u bytes in use]", sizeof(hash.bytes), hash.bytes);
+ done:
+	while (hash.block)
+	{
+		Hblock_t	*bp = hash.block;
+		hash.block = bp->next;
+		free(bp);
+	}
+	free(hash.slot);
+	free(hash.rec);
+	return r;
+}
+
 int
 b_uniq(int argc, char** argv, Shbltin_t* context)
 {
@@ -248,6 +463,7 @@ b_uniq(int argc, char** argv, Shbltin_t* context)
 	Sfio_t *fpin, *fpout;
 	int* all = 0;
 	int sep;
+	int hashed = 0;
 	Compare_f compare = (Compare_f)memcmp;
 
 	cmdinit(argc, argv, context, ERROR_CATALOG, 0);
@@ -277,6 +493,9 @@ b_uniq(int argc, char** argv, Shbltin_t* context)
 			}
 			all = &sep;
 			continue;
+		case 'H':
+			hashed = 1;
+			continue;
 		case 'i':
 			compare = (Compare_f)strncasecmp;
 			continue;
@@ -307,6 +526,8 @@ b_uniq(int argc, char** argv, Shbltin_t* context)
 	argv += opt_info.index;
 	if(all && (mode&C_FLAG))
 		error(2, "-c and -D are mutually exclusive");
+	if(all && hashed)
+		error(2, "-D and -H are mutually exclusive");
 	if(error_info.errors)
 	{
 		error(ERROR_usage(2), "%s", optusage(NULL));
@@ -339,7 +560,10 @@ b_uniq(int argc, char** argv, Shbltin_t* context)
 		error(ERROR_usage(2), "%s", optusage(NULL));
 		UNREACHABLE();
 	}
-	error_info.errors = uniq(fpin,fpout,fields,chars,width,mode,all,compare);
+	if(hashed)
+		error_info.errors = huniq(fpin,fpout,fields,chars,width,mode,compare);
+	else
+		error_info.errors = uniq(fpin,fpout,fields,chars,width,mode,all,compare);
 	if(fpin!=sfstdin)
 		sfclose(fpin);
 	if(fpout!=sfstdout)